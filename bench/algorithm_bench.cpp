@@ -0,0 +1,165 @@
+#include "bench.hpp"
+
+#include <initializer_list>
+
+#include "sut/algorithm"
+
+#include <cstdint>
+
+namespace
+{
+
+using byte = unsigned char;
+
+const std::size_t buffer_size = 512;
+
+byte source[buffer_size];
+byte destination[buffer_size];
+
+const std::size_t table_size = 64;
+
+std::uint16_t table[table_size];
+
+// The element loops the algorithms used before they dispatched on
+// triviality. Host compilers tend to turn these into memcpy/memset calls by
+// themselves, which avr-gcc does not reliably do, so that is disabled here.
+#define ELEMENT_LOOP \
+    __attribute__((noinline, optimize("no-tree-loop-distribute-patterns")))
+
+ELEMENT_LOOP byte* loop_copy(const byte* first, const byte* last, byte* out)
+{
+    while (first != last)
+        *out++ = *first++;
+
+    return out;
+}
+
+ELEMENT_LOOP byte* loop_copy_backward(const byte* first, const byte* last,
+                                      byte* out)
+{
+    while (first != last)
+        *--out = *--last;
+
+    return out;
+}
+
+// The linear scan sorted lookup tables used to be searched with.
+__attribute__((noinline)) const std::uint16_t*
+linear_search(const std::uint16_t* first, const std::uint16_t* last,
+              std::uint16_t value)
+{
+    while (first != last && *first < value)
+        ++first;
+
+    return first;
+}
+
+ELEMENT_LOOP const byte* loop_find(const byte* first, const byte* last,
+                                   byte value)
+{
+    for (; first != last; ++first)
+    {
+        if (*first == value)
+            break;
+    }
+
+    return first;
+}
+
+ELEMENT_LOOP std::size_t loop_count(const byte* first, const byte* last,
+                                    byte value)
+{
+    std::size_t count = 0;
+
+    for (; first != last; ++first)
+        count += *first == value;
+
+    return count;
+}
+
+ELEMENT_LOOP void loop_fill(byte* first, byte* last, byte value)
+{
+    for (; first != last; ++first)
+        *first = value;
+}
+
+}
+
+int main()
+{
+    sut::fill(source, source + buffer_size, byte{0x5a});
+
+    bench::run("copy (element loop)", buffer_size, [] {
+        bench::do_not_optimize(
+            loop_copy(source, source + buffer_size, destination));
+    });
+
+    bench::run("copy (algorithm)", buffer_size, [] {
+        bench::do_not_optimize(
+            sut::copy(source, source + buffer_size, destination));
+    });
+
+    bench::run("copy_backward (element loop)", buffer_size, [] {
+        bench::do_not_optimize(loop_copy_backward(
+            source, source + buffer_size, destination + buffer_size));
+    });
+
+    bench::run("copy_backward (algorithm)", buffer_size, [] {
+        bench::do_not_optimize(sut::copy_backward(
+            source, source + buffer_size, destination + buffer_size));
+    });
+
+    bench::run("fill (element loop)", buffer_size, [] {
+        loop_fill(destination, destination + buffer_size, 0xa5);
+        bench::do_not_optimize(destination);
+    });
+
+    bench::run("fill (algorithm)", buffer_size, [] {
+        sut::fill(destination, destination + buffer_size, byte{0xa5});
+        bench::do_not_optimize(destination);
+    });
+
+    // A frame whose only delimiter is its last byte.
+    source[buffer_size - 1] = 0x7e;
+
+    bench::run("find (element loop)", buffer_size, [] {
+        bench::do_not_optimize(
+            loop_find(source, source + buffer_size, 0x7e));
+    });
+
+    bench::run("find (algorithm)", buffer_size, [] {
+        bench::do_not_optimize(
+            sut::find(source, source + buffer_size, 0x7e));
+    });
+
+    bench::run("count (element loop)", buffer_size, [] {
+        bench::do_not_optimize(
+            loop_count(source, source + buffer_size, 0x7e));
+    });
+
+    bench::run("count (algorithm)", buffer_size, [] {
+        bench::do_not_optimize(
+            sut::count(source, source + buffer_size, 0x7e));
+    });
+
+    for (std::size_t i = 0; i < table_size; ++i)
+        table[i] = std::uint16_t(i * 37);
+
+    bench::run("table lookup (linear scan)", table_size, [] {
+        for (std::size_t i = 0; i < table_size; ++i)
+        {
+            auto key = std::uint16_t(i * 37 * 7 % (table_size * 37));
+            bench::do_not_optimize(
+                linear_search(table, table + table_size, key));
+        }
+    });
+
+    bench::run("table lookup (lower_bound)", table_size, [] {
+        for (std::size_t i = 0; i < table_size; ++i)
+        {
+            auto key = std::uint16_t(i * 37 * 7 % (table_size * 37));
+            bench::do_not_optimize(
+                sut::lower_bound(table, table + table_size, key));
+        }
+    });
+}
@@ -0,0 +1,51 @@
+#ifndef STDAVR_BENCH_HPP
+#define STDAVR_BENCH_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace bench
+{
+
+// Prevents the compiler from optimizing away the computation of value.
+template<typename T>
+inline void do_not_optimize(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+inline std::uint64_t cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
+// Runs f iterations times and prints the average number of (TSC) cycles per
+// unit, where each call to f processes units units (e.g. bytes).
+template<typename F>
+double run(const char* name, std::size_t units, F f,
+           std::size_t iterations = 10000)
+{
+    f();
+
+    auto start = cycles();
+
+    for (std::size_t i = 0; i < iterations; ++i)
+        f();
+
+    auto per_unit = double(cycles() - start) / (double(iterations) * units);
+    std::printf("%-48s %10.3f cycles/unit\n", name, per_unit);
+    return per_unit;
+}
+
+} // namespace bench
+
+#endif
@@ -0,0 +1,60 @@
+#include "bench.hpp"
+
+#include <initializer_list>
+
+#include "sut/numeric"
+
+#include <cstdint>
+
+namespace
+{
+
+const std::size_t taps = 64;
+
+std::int16_t coefficients[taps];
+std::int16_t samples[taps];
+
+// The multiply-accumulate loop every FIR filter used to spell out.
+__attribute__((noinline)) std::int32_t loop_fir(const std::int16_t* x,
+                                                const std::int16_t* h,
+                                                std::size_t n)
+{
+    std::int32_t sum = 0;
+
+    for (std::size_t i = 0; i < n; ++i)
+        sum += std::int32_t(x[i]) * h[i];
+
+    return sum;
+}
+
+}
+
+int main()
+{
+    sut::iota(coefficients, coefficients + taps, std::int16_t{-32});
+    sut::iota(samples, samples + taps, std::int16_t{100});
+
+    bench::run("fir (element loop)", taps, [] {
+        bench::do_not_optimize(loop_fir(samples, coefficients, taps));
+    });
+
+    bench::run("fir (inner_product)", taps, [] {
+        bench::do_not_optimize(sut::inner_product(
+            samples, samples + taps, coefficients, std::int32_t{0}));
+    });
+
+    bench::run("fir (transform_reduce)", taps, [] {
+        bench::do_not_optimize(sut::transform_reduce(
+            samples, samples + taps, coefficients, std::int32_t{0}));
+    });
+
+    bench::run("sum (accumulate)", taps, [] {
+        bench::do_not_optimize(
+            sut::accumulate(samples, samples + taps, std::int32_t{0}));
+    });
+
+    bench::run("sum (reduce)", taps, [] {
+        bench::do_not_optimize(
+            sut::reduce(samples, samples + taps, std::int32_t{0}));
+    });
+}
@@ -0,0 +1,81 @@
+#include "bench.hpp"
+
+#include <initializer_list>
+
+#include "sut/algorithm"
+
+namespace
+{
+
+using byte = unsigned char;
+
+const std::size_t buffer_size = 4096;
+
+byte buffer[buffer_size];
+const byte signature[] = {'S', 'I', 'G', ':', 'd', 'e', 'a', 'd'};
+
+// The O(n*m) search the gateway used to do.
+__attribute__((noinline)) const byte* naive_search(const byte* first,
+                                                   const byte* last,
+                                                   const byte* s_first,
+                                                   const byte* s_last)
+{
+    for (; first != last; ++first)
+    {
+        auto it = first;
+        auto s_it = s_first;
+
+        for (; s_it != s_last && it != last && *it == *s_it; ++it, ++s_it)
+        {
+        }
+
+        if (s_it == s_last)
+            return first;
+    }
+
+    return last;
+}
+
+}
+
+int main()
+{
+    // Log-like text that keeps matching the first few signature bytes, with
+    // the signature itself at the very end.
+    const char text[] = "SIG:ok SIG:dea SIG: ";
+    for (std::size_t i = 0; i < buffer_size; ++i)
+        buffer[i] = byte(text[i % (sizeof(text) - 1)]);
+    sut::copy(sut::begin(signature), sut::end(signature),
+              buffer + buffer_size - sizeof(signature));
+
+    auto first = static_cast<const byte*>(buffer);
+    auto last = first + buffer_size;
+
+    bench::run("naive search", buffer_size, [&] {
+        bench::do_not_optimize(naive_search(first, last,
+                                            sut::begin(signature),
+                                            sut::end(signature)));
+    }, 1000);
+
+    bench::run("search", buffer_size, [&] {
+        bench::do_not_optimize(sut::search(first, last,
+                                           sut::begin(signature),
+                                           sut::end(signature)));
+    }, 1000);
+
+    auto horspool = sut::boyer_moore_horspool_searcher(sut::begin(signature),
+                                                       sut::end(signature));
+
+    bench::run("boyer_moore_horspool_searcher", buffer_size, [&] {
+        bench::do_not_optimize(sut::search(first, last, horspool));
+    }, 1000);
+
+    auto small_horspool = sut::boyer_moore_horspool_searcher<const byte*, 16>(
+        sut::begin(signature), sut::end(signature));
+
+    bench::run("boyer_moore_horspool_searcher (16 entries)", buffer_size,
+               [&] {
+                   bench::do_not_optimize(
+                       sut::search(first, last, small_horspool));
+               }, 1000);
+}
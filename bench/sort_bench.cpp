@@ -0,0 +1,192 @@
+#include "bench.hpp"
+
+#include <initializer_list>
+
+#include "sut/algorithm"
+
+#include <cstdio>
+
+namespace
+{
+
+std::size_t comparisons;
+std::size_t swaps;
+std::size_t moves;
+
+// An element that counts how often it is moved and swapped.
+struct element
+{
+    element() = default;
+    element(int key) : key{key} {}
+
+    element(const element& other) : key{other.key} {++moves;}
+
+    element& operator=(const element& other)
+    {
+        key = other.key;
+        ++moves;
+        return *this;
+    }
+
+    friend void swap(element& lhs, element& rhs)
+    {
+        auto key = lhs.key;
+        lhs.key = rhs.key;
+        rhs.key = key;
+        ++swaps;
+    }
+
+    int key = 0;
+};
+
+struct counting_less
+{
+    bool operator()(const element& lhs, const element& rhs) const
+    {
+        ++comparisons;
+        return lhs.key < rhs.key;
+    }
+};
+
+// The kind of sort that gets hand-rolled when there is no library one.
+template<class T, class Compare>
+void bubble_sort(T* first, T* last, Compare comp)
+{
+    using sut::swap;
+
+    for (bool swapped = true; swapped;)
+    {
+        swapped = false;
+
+        for (auto it = first; it + 1 < last; ++it)
+        {
+            if (comp(it[1], it[0]))
+            {
+                swap(it[0], it[1]);
+                swapped = true;
+            }
+        }
+    }
+}
+
+enum class order {sorted, reversed, random};
+
+const char* order_names[] = {"sorted", "reversed", "random"};
+
+template<class T>
+void generate(T* data, std::size_t size, order kind)
+{
+    std::uint32_t state = 12345;
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        state = state * 1103515245 + 12345;
+
+        switch (kind)
+        {
+        case order::sorted:   data[i] = int(i); break;
+        case order::reversed: data[i] = int(size - i); break;
+        case order::random:   data[i] = int((state >> 16) % size); break;
+        }
+    }
+}
+
+template<class Sort>
+void count(const char* name, std::size_t size, order kind, Sort sort)
+{
+    element data[1024];
+    generate(data, size, kind);
+
+    comparisons = swaps = moves = 0;
+    sort(data, data + size, counting_less{});
+
+    std::printf("%-12s %-8s n=%-5zu %8zu comparisons %8zu swaps %8zu moves\n",
+                name, order_names[int(kind)], size, comparisons, swaps, moves);
+}
+
+const std::size_t cycles_size = 256;
+
+}
+
+int main()
+{
+    for (auto size : {16u, 256u, 1024u})
+    {
+        for (auto kind : {order::sorted, order::reversed, order::random})
+        {
+            count("sort", size, kind, [](auto first, auto last, auto comp) {
+                sut::sort(first, last, comp);
+            });
+            count("stable_sort", size, kind,
+                  [](auto first, auto last, auto comp) {
+                      sut::stable_sort(first, last, comp);
+                  });
+
+            if (size <= 256)
+            {
+                count("bubble_sort", size, kind,
+                      [](auto first, auto last, auto comp) {
+                          bubble_sort(first, last, comp);
+                      });
+            }
+        }
+    }
+
+    int data[cycles_size];
+    auto less = [](int lhs, int rhs) {return lhs < rhs;};
+
+    bench::run("bubble_sort (random ints)", cycles_size, [&] {
+        generate(data, cycles_size, order::random);
+        bubble_sort(data, data + cycles_size, less);
+        bench::do_not_optimize(data);
+    }, 100);
+
+    bench::run("sort (random ints)", cycles_size, [&] {
+        generate(data, cycles_size, order::random);
+        sut::sort(data, data + cycles_size);
+        bench::do_not_optimize(data);
+    }, 100);
+
+    bench::run("stable_sort (random ints)", cycles_size, [&] {
+        generate(data, cycles_size, order::random);
+        sut::stable_sort(data, data + cycles_size);
+        bench::do_not_optimize(data);
+    }, 100);
+
+    // Two sorted halves, e.g. two sensor streams appended to each other.
+    auto halves = [&] {
+        generate(data, cycles_size, order::random);
+        sut::sort(data, data + cycles_size / 2);
+        sut::sort(data + cycles_size / 2, data + cycles_size);
+    };
+    int buffer[cycles_size / 2];
+
+    bench::run("inplace_merge (no buffer)", cycles_size, [&] {
+        halves();
+        sut::inplace_merge(data, data + cycles_size / 2, data + cycles_size);
+        bench::do_not_optimize(data);
+    }, 100);
+
+    bench::run("inplace_merge (buffer)", cycles_size, [&] {
+        halves();
+        sut::inplace_merge(data, data + cycles_size / 2, data + cycles_size,
+                           buffer, buffer + cycles_size / 2);
+        bench::do_not_optimize(data);
+    }, 100);
+
+    const std::size_t window_size = 31;
+    int window[window_size];
+
+    bench::run("median of 31 (sort)", window_size, [&] {
+        generate(window, window_size, order::random);
+        sut::sort(window, window + window_size);
+        bench::do_not_optimize(window[window_size / 2]);
+    });
+
+    bench::run("median of 31 (nth_element)", window_size, [&] {
+        generate(window, window_size, order::random);
+        sut::nth_element(window, window + window_size / 2,
+                         window + window_size);
+        bench::do_not_optimize(window[window_size / 2]);
+    });
+}
@@ -0,0 +1,43 @@
+// Instantiates many large tuples and every one of their get<I>() so that the
+// time it takes to compile this file measures the cost of the tuple
+// implementation. Build the tuple_compile_time target to time it.
+
+#include "sut/tuple"
+
+#include <cstdio>
+#include <utility>
+
+namespace
+{
+
+const std::size_t tuple_count = 32;
+const std::size_t tuple_size = 24;
+
+// A distinct element type per tuple and index so that nothing gets reused
+// between instantiations.
+template<std::size_t K, std::size_t I>
+struct element
+{
+    int value;
+};
+
+template<std::size_t K, std::size_t... Is>
+int sum(std::index_sequence<Is...>)
+{
+    auto tup = sut::tuple<element<K, Is>...>{element<K, Is>{int(Is)}...};
+
+    return (sut::get<Is>(tup).value + ...);
+}
+
+template<std::size_t... Ks>
+int sum_all(std::index_sequence<Ks...>)
+{
+    return (sum<Ks>(std::make_index_sequence<tuple_size>{}) + ...);
+}
+
+}
+
+int main()
+{
+    std::printf("%d\n", sum_all(std::make_index_sequence<tuple_count>{}));
+}
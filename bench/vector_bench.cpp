@@ -0,0 +1,81 @@
+#include "bench.hpp"
+
+#include <initializer_list>
+
+#include "sut/vector"
+
+#include <new>
+
+namespace
+{
+
+using byte = unsigned char;
+
+const std::size_t buffer_size = 512;
+
+// The element loops vector used before it dispatched on triviality. Host
+// compilers tend to turn these into memcpy/memset calls by themselves, which
+// avr-gcc does not reliably do, so that is disabled here.
+#define ELEMENT_LOOP \
+    __attribute__((noinline, optimize("no-tree-loop-distribute-patterns")))
+
+ELEMENT_LOOP byte* loop_copy(const byte* first, const byte* last)
+{
+    auto data = static_cast<byte*>(::operator new[](last - first));
+
+    for (auto out = data; first != last; ++first, ++out)
+        new (out) byte(*first);
+
+    return data;
+}
+
+ELEMENT_LOOP byte* loop_fill(std::size_t count, byte value)
+{
+    auto data = static_cast<byte*>(::operator new[](count));
+
+    for (std::size_t i = 0; i < count; ++i)
+        new (data + i) byte(value);
+
+    return data;
+}
+
+}
+
+int main()
+{
+    auto source = sut::vector<byte>(buffer_size, 0x5a);
+
+    bench::run("copy construct (element loop)", buffer_size, [&] {
+        auto data = loop_copy(source.data(), source.data() + source.size());
+        bench::do_not_optimize(data);
+        ::operator delete[](data);
+    });
+
+    bench::run("copy construct (vector)", buffer_size, [&] {
+        auto copy = source;
+        bench::do_not_optimize(copy.data());
+    });
+
+    bench::run("fill construct (element loop)", buffer_size, [&] {
+        auto data = loop_fill(buffer_size, 0xa5);
+        bench::do_not_optimize(data);
+        ::operator delete[](data);
+    });
+
+    bench::run("fill construct (vector)", buffer_size, [&] {
+        auto vec = sut::vector<byte>(buffer_size, 0xa5);
+        bench::do_not_optimize(vec.data());
+    });
+
+    bench::run("range construct (vector)", buffer_size, [&] {
+        auto vec = sut::vector<byte>(source.begin(), source.end());
+        bench::do_not_optimize(vec.data());
+    });
+
+    auto destination = sut::vector<byte>(buffer_size);
+
+    bench::run("copy assign (vector)", buffer_size, [&] {
+        destination = source;
+        bench::do_not_optimize(destination.data());
+    });
+}
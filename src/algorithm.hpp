@@ -2,17 +2,2066 @@
 #define STDAVR_ALGORITHM_HPP
 
 #include "namespace.hpp"
+#include "utility.hpp"
+#include "functional.hpp"
+#include "numeric.hpp"
+#include "iterator.hpp"
+#include "memory.hpp"
+#include "type_traits.hpp"
+#include "cstring.hpp"
+#include "cstddef.hpp"
 
 namespace STDAVR_NAMESPACE
 {
 
+namespace detail
+{
+
+// Whether filling a range of ForwardIt with a T may be done with memset: the
+// elements have to be single bytes whose assigned value does not depend on
+// what was there before.
+template<typename ForwardIt, typename T, typename = void>
+inline constexpr bool is_byte_fillable_v = false;
+
+template<typename ForwardIt, typename T>
+inline constexpr bool is_byte_fillable_v<
+    ForwardIt, T, require_contiguous_iterators<ForwardIt>> =
+    sizeof(contiguous_element_t<ForwardIt>) == 1 &&
+    is_trivially_copyable_v<contiguous_element_t<ForwardIt>> &&
+    !is_const_v<contiguous_element_t<ForwardIt>> &&
+    (is_same_v<remove_cv_t<T>, contiguous_element_t<ForwardIt>> ||
+     (!is_class_v<contiguous_element_t<ForwardIt>> &&
+      !is_union_v<contiguous_element_t<ForwardIt>>));
+
+// Whether a binary search over ForwardIt for a T may compare without
+// branching: the elements and the key have to be cheap to compare with the
+// default comparison so both sides of every step can be computed and selected
+// with a conditional move.
+template<typename ForwardIt, typename T, typename Compare, typename = void>
+inline constexpr bool is_branchless_searchable_v = false;
+
+template<typename ForwardIt, typename T, typename Compare>
+inline constexpr bool is_branchless_searchable_v<
+    ForwardIt, T, Compare, require_contiguous_iterators<ForwardIt>> =
+    (is_same_v<Compare, less<>> ||
+     is_same_v<Compare, less<contiguous_element_t<ForwardIt>>>) &&
+    !is_class_v<contiguous_element_t<ForwardIt>> &&
+    !is_union_v<contiguous_element_t<ForwardIt>> &&
+    !is_class_v<T> && !is_union_v<T>;
+
+// Whether It refers to single byte integers in contiguous memory that can be
+// searched with memchr or several at a time.
+template<typename It, typename = void>
+inline constexpr bool is_byte_iterator_v = false;
+
+template<typename It>
+inline constexpr bool is_byte_iterator_v<It, require_contiguous_iterators<It>> =
+    sizeof(contiguous_element_t<It>) == 1 &&
+    is_integral_v<contiguous_element_t<It>> &&
+    !is_same_v<remove_cv_t<contiguous_element_t<It>>, bool>;
+
+// Whether comparing elements of It1 and It2 with Pred for equality is the
+// same as comparing their bytes, so whole ranges may be compared with memcmp.
+template<typename It1, typename It2, typename Pred, typename = void>
+inline constexpr bool is_bitwise_comparable_v = false;
+
+template<typename It1, typename It2, typename Pred>
+inline constexpr bool is_bitwise_comparable_v<
+    It1, It2, Pred, require_contiguous_iterators<It1, It2>> =
+    (is_same_v<Pred, equal_to<>> ||
+     is_same_v<Pred, equal_to<remove_cv_t<contiguous_element_t<It1>>>>) &&
+    is_same_v<remove_cv_t<contiguous_element_t<It1>>,
+              remove_cv_t<contiguous_element_t<It2>>> &&
+    is_integral_v<contiguous_element_t<It1>>;
+
+// Loads the machine word starting at p, which need not be aligned.
+inline size_t load_word(const void* p)
+{
+    size_t word;
+    memcpy(&word, p, sizeof(word));
+    return word;
+}
+
+// Counts the bytes of the range equal to value one machine word at a time:
+// after xor'ing with value repeated in every byte, each matching byte is zero
+// and gets its top bit set by the bit trick below. Multiplying the resulting
+// 0/1 bytes by ones then sums them up in the top byte.
+inline size_t count_bytes(const unsigned char* first, const unsigned char* last,
+                          unsigned char value)
+{
+    constexpr auto ones = size_t(-1) / 0xff;
+    constexpr auto low_bits = ones * 0x7f;
+
+    const auto pattern = ones * value;
+    size_t count = 0;
+
+    for (; size_t(last - first) >= sizeof(size_t); first += sizeof(size_t))
+    {
+        auto x = load_word(first) ^ pattern;
+        auto zero_bytes = ~(((x & low_bits) + low_bits) | x | low_bits);
+        count += ((zero_bytes >> 7) * ones) >> (8 * (sizeof(size_t) - 1));
+    }
+
+    for (; first != last; ++first)
+        count += *first == value;
+
+    return count;
+}
+
+} // namespace detail
+
+// The copy and move algorithms lower to a single memmove when both ranges are
+// contiguous and hold the same trivially copyable type. memmove rather than
+// memcpy since the ranges are allowed to overlap as long as the destination
+// does not start inside the source.
+template<class InputIt, class OutputIt>
+OutputIt copy(InputIt first, InputIt last, OutputIt d_first)
+{
+    if constexpr (detail::is_bitwise_copyable_v<InputIt, OutputIt>)
+    {
+        auto count = last - first;
+
+        if (count > 0)
+        {
+            memmove(to_address(d_first), to_address(first),
+                    count * sizeof(*first));
+        }
+
+        return d_first + count;
+    }
+    else
+    {
+        for (; first != last; ++first, ++d_first)
+            *d_first = *first;
+
+        return d_first;
+    }
+}
+
+template<class InputIt, class Size, class OutputIt>
+OutputIt copy_n(InputIt first, Size count, OutputIt d_first)
+{
+    if constexpr (detail::is_bitwise_copyable_v<InputIt, OutputIt>)
+    {
+        return count > 0 ? copy(first, first + count, d_first) : d_first;
+    }
+    else
+    {
+        for (; count > 0; --count, ++first, ++d_first)
+            *d_first = *first;
+
+        return d_first;
+    }
+}
+
+template<class BidirIt1, class BidirIt2>
+BidirIt2 copy_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
+{
+    if constexpr (detail::is_bitwise_copyable_v<BidirIt1, BidirIt2>)
+    {
+        auto count = last - first;
+
+        if (count > 0)
+        {
+            memmove(to_address(d_last - count), to_address(first),
+                    count * sizeof(*first));
+        }
+
+        return d_last - count;
+    }
+    else
+    {
+        while (first != last)
+            *--d_last = *--last;
+
+        return d_last;
+    }
+}
+
 template<class InputIt, class OutputIt>
-OutputIt copy(InputIt in, InputIt in_end, OutputIt out)
+OutputIt move(InputIt first, InputIt last, OutputIt d_first)
+{
+    if constexpr (detail::is_bitwise_copyable_v<InputIt, OutputIt>)
+    {
+        return copy(first, last, d_first);
+    }
+    else
+    {
+        for (; first != last; ++first, ++d_first)
+            *d_first = move(*first);
+
+        return d_first;
+    }
+}
+
+template<class BidirIt1, class BidirIt2>
+BidirIt2 move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
+{
+    if constexpr (detail::is_bitwise_copyable_v<BidirIt1, BidirIt2>)
+    {
+        return copy_backward(first, last, d_last);
+    }
+    else
+    {
+        while (first != last)
+            *--d_last = move(*--last);
+
+        return d_last;
+    }
+}
+
+template<class OutputIt, class Size, class T>
+OutputIt fill_n(OutputIt first, Size count, const T& value)
+{
+    if constexpr (detail::is_byte_fillable_v<OutputIt, T>)
+    {
+        if (count <= 0)
+            return first;
+
+        // Let the first assignment do any conversion and replicate its result.
+        *first = value;
+        unsigned char byte;
+        memcpy(&byte, to_address(first), 1);
+        memset(to_address(first) + 1, byte, count - 1);
+        return first + count;
+    }
+    else
+    {
+        for (; count > 0; --count, ++first)
+            *first = value;
+
+        return first;
+    }
+}
+
+template<class ForwardIt, class T>
+void fill(ForwardIt first, ForwardIt last, const T& value)
+{
+    if constexpr (detail::is_byte_fillable_v<ForwardIt, T>)
+    {
+        fill_n(first, last - first, value);
+    }
+    else
+    {
+        for (; first != last; ++first)
+            *first = value;
+    }
+}
+
+// The non-modifying sequence algorithms. Ranges of single byte integers, as
+// used for protocol frames, are searched with memchr/memcmp or a machine word
+// at a time where possible.
+template<class InputIt, class UnaryPred>
+InputIt find_if(InputIt first, InputIt last, UnaryPred pred)
+{
+    for (; first != last; ++first)
+    {
+        if (pred(*first))
+            return first;
+    }
+
+    return last;
+}
+
+template<class InputIt, class UnaryPred>
+InputIt find_if_not(InputIt first, InputIt last, UnaryPred pred)
+{
+    for (; first != last; ++first)
+    {
+        if (!pred(*first))
+            return first;
+    }
+
+    return last;
+}
+
+template<class InputIt, class T>
+InputIt find(InputIt first, InputIt last, const T& value)
+{
+    if constexpr (detail::is_byte_iterator_v<InputIt> && is_integral_v<T>)
+    {
+        using byte = remove_cv_t<remove_reference_t<decltype(*first)>>;
+
+        // A value that does not fit in a byte cannot be found.
+        if (first == last || byte(value) != value)
+            return last;
+
+        auto bytes =
+            reinterpret_cast<const unsigned char*>(to_address(first));
+        auto found = memchr(bytes, static_cast<unsigned char>(value),
+                            last - first);
+
+        if (found == nullptr)
+            return last;
+
+        return first + (static_cast<const unsigned char*>(found) - bytes);
+    }
+    else
+    {
+        return find_if(first, last,
+                       [&](const auto& element) {return element == value;});
+    }
+}
+
+template<class InputIt, class UnaryPred>
+bool all_of(InputIt first, InputIt last, UnaryPred pred)
+{
+    return find_if_not(first, last, pred) == last;
+}
+
+template<class InputIt, class UnaryPred>
+bool any_of(InputIt first, InputIt last, UnaryPred pred)
+{
+    return find_if(first, last, pred) != last;
+}
+
+template<class InputIt, class UnaryPred>
+bool none_of(InputIt first, InputIt last, UnaryPred pred)
+{
+    return find_if(first, last, pred) == last;
+}
+
+template<class InputIt, class ForwardIt, class BinaryPred>
+InputIt find_first_of(InputIt first, InputIt last,
+                      ForwardIt s_first, ForwardIt s_last, BinaryPred pred)
+{
+    for (; first != last; ++first)
+    {
+        for (auto it = s_first; it != s_last; ++it)
+        {
+            if (pred(*first, *it))
+                return first;
+        }
+    }
+
+    return last;
+}
+
+template<class InputIt, class ForwardIt>
+InputIt find_first_of(InputIt first, InputIt last,
+                      ForwardIt s_first, ForwardIt s_last)
+{
+    return find_first_of(first, last, s_first, s_last, equal_to<>{});
+}
+
+template<class ForwardIt, class BinaryPred>
+ForwardIt adjacent_find(ForwardIt first, ForwardIt last, BinaryPred pred)
+{
+    if (first == last)
+        return last;
+
+    for (auto next = first; ++next != last; first = next)
+    {
+        if (pred(*first, *next))
+            return first;
+    }
+
+    return last;
+}
+
+template<class ForwardIt>
+ForwardIt adjacent_find(ForwardIt first, ForwardIt last)
+{
+    return adjacent_find(first, last, equal_to<>{});
+}
+
+template<class InputIt, class UnaryPred>
+typename iterator_traits<InputIt>::difference_type
+count_if(InputIt first, InputIt last, UnaryPred pred)
+{
+    typename iterator_traits<InputIt>::difference_type count = 0;
+
+    for (; first != last; ++first)
+    {
+        if (pred(*first))
+            ++count;
+    }
+
+    return count;
+}
+
+template<class InputIt, class T>
+typename iterator_traits<InputIt>::difference_type
+count(InputIt first, InputIt last, const T& value)
+{
+    if constexpr (detail::is_byte_iterator_v<InputIt> && is_integral_v<T>)
+    {
+        using byte = remove_cv_t<remove_reference_t<decltype(*first)>>;
+
+        if (byte(value) != value)
+            return 0;
+
+        auto bytes =
+            reinterpret_cast<const unsigned char*>(to_address(first));
+        return detail::count_bytes(bytes, bytes + (last - first),
+                                   static_cast<unsigned char>(value));
+    }
+    else
+    {
+        return count_if(first, last,
+                        [&](const auto& element) {return element == value;});
+    }
+}
+
+template<class InputIt1, class InputIt2, class BinaryPred>
+pair<InputIt1, InputIt2> mismatch(InputIt1 first1, InputIt1 last1,
+                                  InputIt2 first2, BinaryPred pred)
+{
+    if constexpr (detail::is_byte_iterator_v<InputIt1> &&
+                  detail::is_bitwise_comparable_v<InputIt1, InputIt2,
+                                                  BinaryPred>)
+    {
+        // Skip the equal prefix a word at a time. The differing byte is then
+        // found by the loop below.
+        for (; size_t(last1 - first1) >= sizeof(size_t);
+             first1 += sizeof(size_t), first2 += sizeof(size_t))
+        {
+            if (detail::load_word(to_address(first1)) !=
+                detail::load_word(to_address(first2)))
+            {
+                break;
+            }
+        }
+    }
+
+    for (; first1 != last1 && pred(*first1, *first2); ++first1, ++first2)
+    {
+    }
+
+    return {first1, first2};
+}
+
+template<class InputIt1, class InputIt2>
+pair<InputIt1, InputIt2> mismatch(InputIt1 first1, InputIt1 last1,
+                                  InputIt2 first2)
+{
+    return mismatch(first1, last1, first2, equal_to<>{});
+}
+
+template<class InputIt1, class InputIt2, class BinaryPred>
+pair<InputIt1, InputIt2> mismatch(InputIt1 first1, InputIt1 last1,
+                                  InputIt2 first2, InputIt2 last2,
+                                  BinaryPred pred)
+{
+    if constexpr (detail::is_random_access_iterator_v<InputIt1> &&
+                  detail::is_random_access_iterator_v<InputIt2>)
+    {
+        if (last2 - first2 < last1 - first1)
+            last1 = first1 + (last2 - first2);
+
+        return mismatch(first1, last1, first2, pred);
+    }
+    else
+    {
+        for (; first1 != last1 && first2 != last2 && pred(*first1, *first2);
+             ++first1, ++first2)
+        {
+        }
+
+        return {first1, first2};
+    }
+}
+
+template<class InputIt1, class InputIt2>
+pair<InputIt1, InputIt2> mismatch(InputIt1 first1, InputIt1 last1,
+                                  InputIt2 first2, InputIt2 last2)
+{
+    return mismatch(first1, last1, first2, last2, equal_to<>{});
+}
+
+template<class InputIt1, class InputIt2, class BinaryPred>
+bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2, BinaryPred pred)
+{
+    if constexpr (detail::is_bitwise_comparable_v<InputIt1, InputIt2,
+                                                  BinaryPred>)
+    {
+        auto count = last1 - first1;
+        return count <= 0 ||
+               memcmp(to_address(first1), to_address(first2),
+                      count * sizeof(*first1)) == 0;
+    }
+    else
+    {
+        for (; first1 != last1; ++first1, ++first2)
+        {
+            if (!pred(*first1, *first2))
+                return false;
+        }
+
+        return true;
+    }
+}
+
+template<class InputIt1, class InputIt2>
+bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2)
+{
+    return equal(first1, last1, first2, equal_to<>{});
+}
+
+template<class InputIt1, class InputIt2, class BinaryPred>
+bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2,
+           BinaryPred pred)
+{
+    if constexpr (detail::is_random_access_iterator_v<InputIt1> &&
+                  detail::is_random_access_iterator_v<InputIt2>)
+    {
+        return last1 - first1 == last2 - first2 &&
+               equal(first1, last1, first2, pred);
+    }
+    else
+    {
+        for (; first1 != last1 && first2 != last2; ++first1, ++first2)
+        {
+            if (!pred(*first1, *first2))
+                return false;
+        }
+
+        return first1 == last1 && first2 == last2;
+    }
+}
+
+template<class InputIt1, class InputIt2>
+bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2)
+{
+    return equal(first1, last1, first2, last2, equal_to<>{});
+}
+
+// Returns the first occurrence of [s_first, s_last) in [first, last). Byte
+// ranges look for candidates with memchr and compare them with memcmp.
+template<class ForwardIt1, class ForwardIt2, class BinaryPred>
+ForwardIt1 search(ForwardIt1 first, ForwardIt1 last,
+                  ForwardIt2 s_first, ForwardIt2 s_last, BinaryPred pred)
+{
+    if constexpr (detail::is_byte_iterator_v<ForwardIt1> &&
+                  detail::is_bitwise_comparable_v<ForwardIt1, ForwardIt2,
+                                                  BinaryPred>)
+    {
+        auto length = s_last - s_first;
+
+        if (length == 0)
+            return first;
+
+        for (; last - first >= length; ++first)
+        {
+            first = find(first, last - length + 1, *s_first);
+
+            if (first == last - length + 1)
+                return last;
+
+            if (equal(first + 1, first + length, s_first + 1, pred))
+                return first;
+        }
+
+        return last;
+    }
+    else
+    {
+        for (;; ++first)
+        {
+            auto it = first;
+
+            for (auto s_it = s_first;; ++it, ++s_it)
+            {
+                if (s_it == s_last)
+                    return first;
+
+                if (it == last)
+                    return last;
+
+                if (!pred(*it, *s_it))
+                    break;
+            }
+        }
+    }
+}
+
+template<class ForwardIt1, class ForwardIt2>
+ForwardIt1 search(ForwardIt1 first, ForwardIt1 last,
+                  ForwardIt2 s_first, ForwardIt2 s_last)
+{
+    return search(first, last, s_first, s_last, equal_to<>{});
+}
+
+// Returns the first run of count elements equal to value. After a mismatch the
+// search resumes behind the mismatching element.
+template<class ForwardIt, class Size, class T, class BinaryPred>
+ForwardIt search_n(ForwardIt first, ForwardIt last, Size count,
+                   const T& value, BinaryPred pred)
+{
+    if (count <= 0)
+        return first;
+
+    for (; first != last; ++first)
+    {
+        if (!pred(*first, value))
+            continue;
+
+        auto run_first = first;
+        Size run = 1;
+
+        for (;;)
+        {
+            if (run == count)
+                return run_first;
+
+            if (++first == last)
+                return last;
+
+            if (!pred(*first, value))
+                break;
+
+            ++run;
+        }
+    }
+
+    return last;
+}
+
+template<class ForwardIt, class Size, class T>
+ForwardIt search_n(ForwardIt first, ForwardIt last, Size count,
+                   const T& value)
+{
+    return search_n(first, last, count, value, equal_to<>{});
+}
+
+// Searchers find the first occurrence of a pattern given up front in any
+// number of ranges, and are used with the search(first, last, searcher)
+// overload. default_searcher does what search() does.
+template<class ForwardIt, class BinaryPred = equal_to<>>
+class default_searcher
+{
+public:
+
+    default_searcher(ForwardIt pat_first, ForwardIt pat_last,
+                     BinaryPred pred = BinaryPred())
+        : pat_first_{pat_first}, pat_last_{pat_last}, pred_{pred}
+    {
+    }
+
+    template<class ForwardIt2>
+    pair<ForwardIt2, ForwardIt2> operator()(ForwardIt2 first,
+                                            ForwardIt2 last) const
+    {
+        auto found = search(first, last, pat_first_, pat_last_, pred_);
+
+        if (found == last)
+            return {last, last};
+
+        return {found,
+                next(found, distance(pat_first_, pat_last_))};
+    }
+
+private:
+
+    ForwardIt pat_first_;
+    ForwardIt pat_last_;
+    BinaryPred pred_;
+};
+
+// Finds the pattern in O(n / m) comparisons in the best case by shifting it
+// along the searched range by more than one element at a time, depending on
+// the last element of the current window.
+//
+// The shifts are kept in a table of TableSize bytes indexed by the low bits of
+// the elements, which must therefore be integers. The default covers all byte
+// values; smaller (power of two) tables save RAM at the cost of shorter
+// shifts when elements share a table entry. Shifts are capped to 255, so
+// patterns longer than that are still found but not skipped over as quickly.
+// pred may only consider elements equal whose integer values are equal.
+template<class RandomIt, size_t TableSize = 256,
+         class BinaryPred = equal_to<>>
+class boyer_moore_horspool_searcher
+{
+    static_assert(TableSize > 0 && (TableSize & (TableSize - 1)) == 0,
+                  "TableSize must be a power of two");
+
+    using pattern_value_type = typename iterator_traits<RandomIt>::value_type;
+
+    static_assert(is_integral_v<pattern_value_type>,
+                  "boyer_moore_horspool_searcher requires integers");
+
+public:
+
+    boyer_moore_horspool_searcher(RandomIt pat_first, RandomIt pat_last,
+                                  BinaryPred pred = BinaryPred())
+        : pat_first_{pat_first}, pat_last_{pat_last}, pred_{pred}
+    {
+        auto length = pat_last - pat_first;
+
+        fill(shifts_, shifts_ + TableSize, capped(length));
+
+        // Later elements overwrite the shifts of earlier ones sharing their
+        // entry with smaller ones, so every entry ends up with the smallest
+        // shift that is still safe.
+        for (decltype(length) i = 0; i + 1 < length; ++i)
+            shifts_[index(pat_first[i])] = capped(length - 1 - i);
+    }
+
+    template<class RandomIt2>
+    pair<RandomIt2, RandomIt2> operator()(RandomIt2 first,
+                                          RandomIt2 last) const
+    {
+        auto length = pat_last_ - pat_first_;
+
+        if (length == 0)
+            return {first, first};
+
+        const auto& pat_back = *(pat_last_ - 1);
+
+        for (; last - first >= length;
+             first += shifts_[index(first[length - 1])])
+        {
+            if (pred_(first[length - 1], pat_back) &&
+                equal(first, first + (length - 1), pat_first_, pred_))
+            {
+                return {first, first + length};
+            }
+        }
+
+        return {last, last};
+    }
+
+private:
+
+    template<class T>
+    static size_t index(const T& value)
+    {
+        return static_cast<size_t>(value) & (TableSize - 1);
+    }
+
+    template<class Distance>
+    static unsigned char capped(Distance shift)
+    {
+        return shift < 255 ? static_cast<unsigned char>(shift) : 255;
+    }
+
+    RandomIt pat_first_;
+    RandomIt pat_last_;
+    BinaryPred pred_;
+    unsigned char shifts_[TableSize];
+};
+
+template<class ForwardIt, class Searcher>
+ForwardIt search(ForwardIt first, ForwardIt last, const Searcher& searcher)
+{
+    return searcher(first, last).first;
+}
+
+// The mutating sequence algorithms all work in place with O(1) extra memory,
+// e.g. vec.erase(remove_if(vec.begin(), vec.end(), pred), vec.end()) filters
+// a vector without allocating.
+template<class ForwardIt1, class ForwardIt2>
+void iter_swap(ForwardIt1 a, ForwardIt2 b)
+{
+    using STDAVR_NAMESPACE::swap;
+
+    swap(*a, *b);
+}
+
+template<class ForwardIt1, class ForwardIt2>
+ForwardIt2 swap_ranges(ForwardIt1 first1, ForwardIt1 last1, ForwardIt2 first2)
 {
-    while (in != in_end)
-        *out++ = *in++;
+    for (; first1 != last1; ++first1, ++first2)
+        iter_swap(first1, first2);
+
+    return first2;
+}
+
+template<class ForwardIt, class UnaryPred, class T>
+void replace_if(ForwardIt first, ForwardIt last, UnaryPred pred,
+                const T& new_value)
+{
+    for (; first != last; ++first)
+    {
+        if (pred(*first))
+            *first = new_value;
+    }
+}
+
+template<class ForwardIt, class T>
+void replace(ForwardIt first, ForwardIt last, const T& old_value,
+             const T& new_value)
+{
+    replace_if(first, last,
+               [&](const auto& element) {return element == old_value;},
+               new_value);
+}
+
+// Moves the elements not satisfying pred to the front, keeping their order,
+// and returns the end of them. The elements after that are left in a valid
+// but unspecified state.
+template<class ForwardIt, class UnaryPred>
+ForwardIt remove_if(ForwardIt first, ForwardIt last, UnaryPred pred)
+{
+    first = find_if(first, last, pred);
+
+    if (first != last)
+    {
+        for (auto it = first; ++it != last;)
+        {
+            if (!pred(*it))
+                *first++ = move(*it);
+        }
+    }
+
+    return first;
+}
+
+template<class ForwardIt, class T>
+ForwardIt remove(ForwardIt first, ForwardIt last, const T& value)
+{
+    return remove_if(first, last,
+                     [&](const auto& element) {return element == value;});
+}
+
+// Removes all but the first element of every run of consecutive equivalent
+// elements like remove_if() does.
+template<class ForwardIt, class BinaryPred>
+ForwardIt unique(ForwardIt first, ForwardIt last, BinaryPred pred)
+{
+    first = adjacent_find(first, last, pred);
+
+    if (first == last)
+        return last;
+
+    auto result = first;
+    ++first;
+
+    while (++first != last)
+    {
+        if (!pred(*result, *first))
+            *++result = move(*first);
+    }
+
+    return ++result;
+}
+
+template<class ForwardIt>
+ForwardIt unique(ForwardIt first, ForwardIt last)
+{
+    return unique(first, last, equal_to<>{});
+}
+
+template<class BidirIt>
+void reverse(BidirIt first, BidirIt last)
+{
+    while (first != last && first != --last)
+        iter_swap(first++, last);
+}
+
+// Rotates [first, last) such that middle becomes the first element and returns
+// the new position of first.
+//
+// Random access ranges are rotated with the cycle leader algorithm, which
+// moves every element straight to its final position. Other ranges swap the
+// block before middle with the one after it until both are in place.
+template<class ForwardIt>
+ForwardIt rotate(ForwardIt first, ForwardIt middle, ForwardIt last)
+{
+    if (first == middle)
+        return last;
+
+    if (middle == last)
+        return first;
+
+    if constexpr (detail::is_random_access_iterator_v<ForwardIt>)
+    {
+        auto size = last - first;
+        auto shift = middle - first;
+
+        if (shift == size - shift)
+        {
+            swap_ranges(first, middle, middle);
+            return middle;
+        }
+
+        // The element at i has to come from i + shift, modulo size, which
+        // splits the range into gcd(size, shift) cycles.
+        for (auto cycles = gcd(size, shift); cycles > 0; --cycles)
+        {
+            auto leader = first + (cycles - 1);
+            auto value = move(*leader);
+            auto hole = leader;
+
+            for (;;)
+            {
+                auto next = last - hole > shift ? hole + shift
+                                                : first + (shift -
+                                                           (last - hole));
+                if (next == leader)
+                    break;
+
+                *hole = move(*next);
+                hole = next;
+            }
+
+            *hole = move(value);
+        }
+
+        return first + (size - shift);
+    }
+    else
+    {
+        auto it = middle;
+
+        for (;;)
+        {
+            iter_swap(first++, it++);
+
+            if (it == last)
+                break;
+
+            if (first == middle)
+                middle = it;
+        }
+
+        auto result = first;
+
+        // Rotate the rest of the range, now [first, middle, last), the same
+        // way.
+        for (it = middle; first != middle;)
+        {
+            iter_swap(first++, it++);
+
+            if (it == last)
+                it = middle;
+            else if (first == middle)
+                middle = it;
+        }
+
+        return result;
+    }
+}
+
+template<class InputIt, class UnaryPred>
+bool is_partitioned(InputIt first, InputIt last, UnaryPred pred)
+{
+    return none_of(find_if_not(first, last, pred), last, pred);
+}
+
+// Moves the elements satisfying pred before the ones that do not and returns
+// the start of the latter. Bidirectional ranges are partitioned from both
+// ends, which swaps every misplaced element only once.
+template<class ForwardIt, class UnaryPred>
+ForwardIt partition(ForwardIt first, ForwardIt last, UnaryPred pred)
+{
+    if constexpr (detail::is_bidirectional_iterator_v<ForwardIt>)
+    {
+        for (;; ++first)
+        {
+            for (;; ++first)
+            {
+                if (first == last)
+                    return first;
+
+                if (!pred(*first))
+                    break;
+            }
+
+            do
+            {
+                if (first == --last)
+                    return first;
+            }
+            while (!pred(*last));
+
+            iter_swap(first, last);
+        }
+    }
+    else
+    {
+        first = find_if_not(first, last, pred);
+
+        if (first == last)
+            return first;
+
+        for (auto it = first; ++it != last;)
+        {
+            if (pred(*it))
+                iter_swap(it, first++);
+        }
+
+        return first;
+    }
+}
+
+namespace detail
+{
+
+// Stably partitions the size elements starting at first, the first of which
+// must not satisfy pred, by partitioning both halves and rotating the
+// elements that do not satisfy pred in the first half past the ones that do
+// in the second. Takes O(n log n) swaps and recurses O(log n) deep.
+template<class ForwardIt, class UnaryPred, class Distance>
+ForwardIt inplace_stable_partition(ForwardIt first, UnaryPred pred,
+                                   Distance size)
+{
+    if (size == 1)
+        return first;
+
+    auto half = size / 2;
+    auto middle = next(first, half);
+    auto left_split = inplace_stable_partition(first, pred, half);
 
-    return out;
+    auto right_split = middle;
+    auto right_size = size - half;
+
+    for (; right_size > 0 && pred(*right_split); --right_size)
+        ++right_split;
+
+    if (right_size > 0)
+        right_split = inplace_stable_partition(right_split, pred, right_size);
+
+    return rotate(left_split, middle, right_split);
+}
+
+} // namespace detail
+
+// Like partition() but keeps the relative order of the elements. Unlike the
+// standard one, this never allocates a buffer.
+template<class ForwardIt, class UnaryPred>
+ForwardIt stable_partition(ForwardIt first, ForwardIt last, UnaryPred pred)
+{
+    first = find_if_not(first, last, pred);
+
+    if (first == last)
+        return first;
+
+    return detail::inplace_stable_partition(first, pred,
+                                            distance(first, last));
+}
+
+template<class ForwardIt, class UnaryPred>
+ForwardIt partition_point(ForwardIt first, ForwardIt last, UnaryPred pred)
+{
+    for (auto count = distance(first, last); count > 0;)
+    {
+        auto half = count / 2;
+        auto middle = next(first, half);
+
+        if (pred(*middle))
+        {
+            first = ++middle;
+            count -= half + 1;
+        }
+        else
+        {
+            count = half;
+        }
+    }
+
+    return first;
+}
+
+// Binary searches take O(log n) comparisons. Random access iterators also
+// take O(log n) steps while other forward iterators take O(n).
+//
+// Pointers to scalars searched with the default comparison use a branchless
+// loop that always runs for the same number of iterations for a given size,
+// which makes lookups in sorted tables predictable in cycle count.
+template<class ForwardIt, class T, class Compare>
+ForwardIt lower_bound(ForwardIt first, ForwardIt last, const T& value,
+                      Compare comp)
+{
+    if constexpr (detail::is_branchless_searchable_v<ForwardIt, T, Compare>)
+    {
+        auto count = last - first;
+
+        if (count == 0)
+            return first;
+
+        for (; count > 1; count -= count / 2)
+        {
+            auto middle = first + count / 2;
+            first = comp(*middle, value) ? middle : first;
+        }
+
+        return first + comp(*first, value);
+    }
+    else
+    {
+        for (auto count = distance(first, last); count > 0;)
+        {
+            auto half = count / 2;
+            auto middle = next(first, half);
+
+            if (comp(*middle, value))
+            {
+                first = ++middle;
+                count -= half + 1;
+            }
+            else
+            {
+                count = half;
+            }
+        }
+
+        return first;
+    }
+}
+
+template<class ForwardIt, class T>
+ForwardIt lower_bound(ForwardIt first, ForwardIt last, const T& value)
+{
+    return lower_bound(first, last, value, less<>{});
+}
+
+template<class ForwardIt, class T, class Compare>
+ForwardIt upper_bound(ForwardIt first, ForwardIt last, const T& value,
+                      Compare comp)
+{
+    if constexpr (detail::is_branchless_searchable_v<ForwardIt, T, Compare>)
+    {
+        auto count = last - first;
+
+        if (count == 0)
+            return first;
+
+        for (; count > 1; count -= count / 2)
+        {
+            auto middle = first + count / 2;
+            first = comp(value, *middle) ? first : middle;
+        }
+
+        return first + !comp(value, *first);
+    }
+    else
+    {
+        for (auto count = distance(first, last); count > 0;)
+        {
+            auto half = count / 2;
+            auto middle = next(first, half);
+
+            if (!comp(value, *middle))
+            {
+                first = ++middle;
+                count -= half + 1;
+            }
+            else
+            {
+                count = half;
+            }
+        }
+
+        return first;
+    }
+}
+
+template<class ForwardIt, class T>
+ForwardIt upper_bound(ForwardIt first, ForwardIt last, const T& value)
+{
+    return upper_bound(first, last, value, less<>{});
+}
+
+template<class ForwardIt, class T, class Compare>
+pair<ForwardIt, ForwardIt> equal_range(ForwardIt first, ForwardIt last,
+                                       const T& value, Compare comp)
+{
+    auto lower = lower_bound(first, last, value, comp);
+    return {lower, upper_bound(lower, last, value, comp)};
+}
+
+template<class ForwardIt, class T>
+pair<ForwardIt, ForwardIt> equal_range(ForwardIt first, ForwardIt last,
+                                       const T& value)
+{
+    return equal_range(first, last, value, less<>{});
+}
+
+template<class ForwardIt, class T, class Compare>
+bool binary_search(ForwardIt first, ForwardIt last, const T& value,
+                   Compare comp)
+{
+    first = lower_bound(first, last, value, comp);
+    return first != last && !comp(value, *first);
+}
+
+template<class ForwardIt, class T>
+bool binary_search(ForwardIt first, ForwardIt last, const T& value)
+{
+    return binary_search(first, last, value, less<>{});
+}
+
+namespace detail
+{
+
+// Moves the element at index down the max-heap [first, first + size) until
+// neither of its children is greater.
+template<class RandomIt, class Distance, class Compare>
+void sift_down(RandomIt first, Distance index, Distance size, Compare comp)
+{
+    auto value = move(first[index]);
+
+    for (auto child = 2 * index + 1; child < size; child = 2 * index + 1)
+    {
+        if (child + 1 < size && comp(first[child], first[child + 1]))
+            ++child;
+
+        if (!comp(value, first[child]))
+            break;
+
+        first[index] = move(first[child]);
+        index = child;
+    }
+
+    first[index] = move(value);
+}
+
+// Moves the element at index up the max-heap starting at first until its
+// parent is not less than it.
+template<class RandomIt, class Distance, class Compare>
+void sift_up(RandomIt first, Distance index, Compare comp)
+{
+    auto value = move(first[index]);
+
+    for (auto parent = (index - 1) / 2;
+         index > 0 && comp(first[parent], value);
+         parent = (index - 1) / 2)
+    {
+        first[index] = move(first[parent]);
+        index = parent;
+    }
+
+    first[index] = move(value);
+}
+
+} // namespace detail
+
+// The heap algorithms maintain a binary max-heap with respect to comp: the
+// greatest element is at the front and pushing or popping an element takes
+// O(log n) comparisons, without any recursion.
+template<class RandomIt, class Compare>
+RandomIt is_heap_until(RandomIt first, RandomIt last, Compare comp)
+{
+    auto size = last - first;
+
+    for (decltype(size) child = 1; child < size; ++child)
+    {
+        if (comp(first[(child - 1) / 2], first[child]))
+            return first + child;
+    }
+
+    return last;
+}
+
+template<class RandomIt>
+RandomIt is_heap_until(RandomIt first, RandomIt last)
+{
+    return is_heap_until(first, last, less<>{});
+}
+
+template<class RandomIt, class Compare>
+bool is_heap(RandomIt first, RandomIt last, Compare comp)
+{
+    return is_heap_until(first, last, comp) == last;
+}
+
+template<class RandomIt>
+bool is_heap(RandomIt first, RandomIt last)
+{
+    return is_heap(first, last, less<>{});
+}
+
+// Adds *(last - 1) to the heap [first, last - 1).
+template<class RandomIt, class Compare>
+void push_heap(RandomIt first, RandomIt last, Compare comp)
+{
+    auto size = last - first;
+
+    if (size > 1)
+        detail::sift_up(first, size - 1, comp);
+}
+
+template<class RandomIt>
+void push_heap(RandomIt first, RandomIt last)
+{
+    push_heap(first, last, less<>{});
+}
+
+// Moves the greatest element of the heap [first, last) to last - 1 and makes
+// [first, last - 1) a heap again.
+template<class RandomIt, class Compare>
+void pop_heap(RandomIt first, RandomIt last, Compare comp)
+{
+    auto size = last - first;
+
+    if (size > 1)
+    {
+        swap(*first, *--last);
+        detail::sift_down(first, decltype(size){0}, size - 1, comp);
+    }
+}
+
+template<class RandomIt>
+void pop_heap(RandomIt first, RandomIt last)
+{
+    pop_heap(first, last, less<>{});
+}
+
+// Builds a heap in O(n) comparisons.
+template<class RandomIt, class Compare>
+void make_heap(RandomIt first, RandomIt last, Compare comp)
+{
+    auto size = last - first;
+
+    for (auto i = size / 2; i > 0; --i)
+        detail::sift_down(first, i - 1, size, comp);
+}
+
+template<class RandomIt>
+void make_heap(RandomIt first, RandomIt last)
+{
+    make_heap(first, last, less<>{});
+}
+
+template<class RandomIt, class Compare>
+void sort_heap(RandomIt first, RandomIt last, Compare comp)
+{
+    for (; last - first > 1; --last)
+        pop_heap(first, last, comp);
+}
+
+template<class RandomIt>
+void sort_heap(RandomIt first, RandomIt last)
+{
+    sort_heap(first, last, less<>{});
+}
+
+namespace detail
+{
+
+// The number of partitions after which introsort and introselect give up on
+// quicksort-style partitioning: 2 * log2(size).
+template<class Distance>
+int depth_limit(Distance size)
+{
+    int limit = 0;
+
+    for (; size > 1; size /= 2)
+        limit += 2;
+
+    return limit;
+}
+
+// Below this many elements, sorting falls back to insertion sort which does
+// less work than partitioning for tiny ranges.
+inline constexpr ptrdiff_t insertion_sort_threshold = 16;
+
+// Stable, and linear for ranges that are already (almost) sorted.
+template<class RandomIt, class Compare>
+void insertion_sort(RandomIt first, RandomIt last, Compare comp)
+{
+    if (first == last)
+        return;
+
+    for (auto i = first + 1; i != last; ++i)
+    {
+        auto value = move(*i);
+        auto hole = i;
+
+        for (; hole != first && comp(value, *(hole - 1)); --hole)
+            *hole = move(*(hole - 1));
+
+        *hole = move(value);
+    }
+}
+
+// Iterative, so it needs no stack no matter the size of the range.
+template<class RandomIt, class Compare>
+void heap_sort(RandomIt first, RandomIt last, Compare comp)
+{
+    make_heap(first, last, comp);
+    sort_heap(first, last, comp);
+}
+
+// Partitions [first, last), which must contain at least three elements, around
+// the median of its first, middle and last elements. Returns the start of the
+// upper part.
+template<class RandomIt, class Compare>
+RandomIt partition_around_median(RandomIt first, RandomIt last, Compare comp)
+{
+    auto a = first + 1;
+    auto b = first + (last - first) / 2;
+    auto c = last - 1;
+
+    if (comp(*b, *a))
+        swap(*a, *b);
+    if (comp(*c, *b))
+        swap(*b, *c);
+    if (comp(*b, *a))
+        swap(*a, *b);
+
+    // With the pivot moved to the front, *a and *c bound the scans below so
+    // they need no range checks.
+    swap(*first, *b);
+
+    auto pivot = first;
+    auto lo = first + 1;
+    auto hi = last;
+
+    for (;;)
+    {
+        while (comp(*lo, *pivot))
+            ++lo;
+
+        --hi;
+
+        while (comp(*pivot, *hi))
+            --hi;
+
+        if (!(lo < hi))
+            return lo;
+
+        swap(*lo, *hi);
+        ++lo;
+    }
+}
+
+// Quicksort that recurses into the smaller part only, so the recursion depth is
+// at most log2(n), and switches to heap sort once depth_limit partitions have
+// been made to bound the running time to O(n log n).
+template<class RandomIt, class Compare>
+void introsort(RandomIt first, RandomIt last, int depth_limit, Compare comp)
+{
+    while (last - first > insertion_sort_threshold)
+    {
+        if (depth_limit-- == 0)
+        {
+            heap_sort(first, last, comp);
+            return;
+        }
+
+        auto cut = partition_around_median(first, last, comp);
+
+        if (cut - first < last - cut)
+        {
+            introsort(first, cut, depth_limit, comp);
+            first = cut;
+        }
+        else
+        {
+            introsort(cut, last, depth_limit, comp);
+            last = cut;
+        }
+    }
+
+    insertion_sort(first, last, comp);
+}
+
+// Merges the sorted ranges [first, middle) and [middle, last) by moving the
+// first range into the buffer, which must be able to hold it.
+template<class BidirIt, class BufferIt, class Compare>
+void merge_forward(BidirIt first, BidirIt middle, BidirIt last,
+                   BufferIt buffer, Compare comp)
+{
+    auto buffer_last = move(first, middle, buffer);
+
+    for (; buffer != buffer_last; ++first)
+    {
+        if (middle == last)
+        {
+            move(buffer, buffer_last, first);
+            return;
+        }
+
+        if (comp(*middle, *buffer))
+            *first = move(*middle++);
+        else
+            *first = move(*buffer++);
+    }
+}
+
+// Like merge_forward() but moves the second range into the buffer and merges
+// from the back. Both ranges must not be empty.
+template<class BidirIt, class BufferIt, class Compare>
+void merge_backward(BidirIt first, BidirIt middle, BidirIt last,
+                    BufferIt buffer, Compare comp)
+{
+    auto buffer_last = move(middle, last, buffer);
+    --middle;
+    --buffer_last;
+
+    for (;;)
+    {
+        if (comp(*buffer_last, *middle))
+        {
+            *--last = move(*middle);
+
+            if (middle == first)
+            {
+                move_backward(buffer, ++buffer_last, last);
+                return;
+            }
+
+            --middle;
+        }
+        else
+        {
+            *--last = move(*buffer_last);
+
+            if (buffer_last == buffer)
+                return;
+
+            --buffer_last;
+        }
+    }
+}
+
+// Merges the sorted ranges [first, middle) and [middle, last) of len1 and len2
+// elements in place. Once the shorter range fits into the buffer of
+// buffer_size elements, it is moved there and merged in linear time.
+// Otherwise the upper part of the first range is rotated past the lower part
+// of the second one, which needs O(n log n) moves but no buffer. Recursing
+// into the smaller half only keeps the recursion depth at O(log n).
+template<class BidirIt, class Distance, class BufferIt, class Compare>
+void merge_adaptive(BidirIt first, BidirIt middle, BidirIt last,
+                    Distance len1, Distance len2, BufferIt buffer,
+                    Distance buffer_size, Compare comp)
+{
+    while (len1 != 0 && len2 != 0)
+    {
+        if (len1 <= len2 && len1 <= buffer_size)
+        {
+            merge_forward(first, middle, last, buffer, comp);
+            return;
+        }
+
+        if (len2 <= buffer_size)
+        {
+            merge_backward(first, middle, last, buffer, comp);
+            return;
+        }
+
+        if (len1 + len2 == 2)
+        {
+            if (comp(*middle, *first))
+                iter_swap(first, middle);
+
+            return;
+        }
+
+        BidirIt first_cut;
+        BidirIt second_cut;
+        Distance len11;
+        Distance len22;
+
+        if (len1 > len2)
+        {
+            len11 = len1 / 2;
+            first_cut = next(first, len11);
+            second_cut = lower_bound(middle, last, *first_cut, comp);
+            len22 = distance(middle, second_cut);
+        }
+        else
+        {
+            len22 = len2 / 2;
+            second_cut = next(middle, len22);
+            first_cut = upper_bound(first, middle, *second_cut, comp);
+            len11 = distance(first, first_cut);
+        }
+
+        auto new_middle = rotate(first_cut, middle, second_cut);
+
+        if (len11 + len22 < len1 - len11 + len2 - len22)
+        {
+            merge_adaptive(first, first_cut, new_middle, len11, len22, buffer,
+                           buffer_size, comp);
+            first = new_middle;
+            middle = second_cut;
+            len1 -= len11;
+            len2 -= len22;
+        }
+        else
+        {
+            merge_adaptive(new_middle, second_cut, last, len1 - len11,
+                           len2 - len22, buffer, buffer_size, comp);
+            last = new_middle;
+            middle = first_cut;
+            len1 = len11;
+            len2 = len22;
+        }
+    }
+}
+
+template<class BidirIt, class Distance, class Compare>
+void merge_without_buffer(BidirIt first, BidirIt middle, BidirIt last,
+                          Distance len1, Distance len2, Compare comp)
+{
+    using value_type = typename iterator_traits<BidirIt>::value_type;
+
+    merge_adaptive(first, middle, last, len1, len2,
+                   static_cast<value_type*>(nullptr), Distance(0), comp);
+}
+
+template<class RandomIt, class Compare>
+void inplace_stable_sort(RandomIt first, RandomIt last, Compare comp)
+{
+    if (last - first <= insertion_sort_threshold)
+    {
+        insertion_sort(first, last, comp);
+        return;
+    }
+
+    auto middle = first + (last - first) / 2;
+    inplace_stable_sort(first, middle, comp);
+    inplace_stable_sort(middle, last, comp);
+
+    // Already ordered halves, e.g. of presorted input, need no merging.
+    if (comp(*middle, *(middle - 1)))
+    {
+        merge_without_buffer(first, middle, last, middle - first,
+                             last - middle, comp);
+    }
+}
+
+} // namespace detail
+
+template<class ForwardIt, class Compare>
+ForwardIt is_sorted_until(ForwardIt first, ForwardIt last, Compare comp)
+{
+    if (first == last)
+        return last;
+
+    for (auto next = first; ++next != last; first = next)
+    {
+        if (comp(*next, *first))
+            return next;
+    }
+
+    return last;
+}
+
+template<class ForwardIt>
+ForwardIt is_sorted_until(ForwardIt first, ForwardIt last)
+{
+    return is_sorted_until(first, last, less<>{});
+}
+
+template<class ForwardIt, class Compare>
+bool is_sorted(ForwardIt first, ForwardIt last, Compare comp)
+{
+    return is_sorted_until(first, last, comp) == last;
+}
+
+template<class ForwardIt>
+bool is_sorted(ForwardIt first, ForwardIt last)
+{
+    return is_sorted(first, last, less<>{});
+}
+
+// Sorts without allocating in O(n log n) time. The recursion depth is bounded
+// by log2(n), which matters on targets where the stack silently runs into the
+// static data.
+template<class RandomIt, class Compare>
+void sort(RandomIt first, RandomIt last, Compare comp)
+{
+    detail::introsort(first, last, detail::depth_limit(last - first), comp);
+}
+
+template<class RandomIt>
+void sort(RandomIt first, RandomIt last)
+{
+    sort(first, last, less<>{});
+}
+
+// Unlike the standard one, this never allocates a merge buffer: it always takes
+// the O(n log^2 n) in-place route.
+template<class RandomIt, class Compare>
+void stable_sort(RandomIt first, RandomIt last, Compare comp)
+{
+    detail::inplace_stable_sort(first, last, comp);
+}
+
+template<class RandomIt>
+void stable_sort(RandomIt first, RandomIt last)
+{
+    stable_sort(first, last, less<>{});
+}
+
+// Merges two sorted ranges into d_first in linear time. Equivalent elements
+// of the first range come before those of the second one.
+template<class InputIt1, class InputIt2, class OutputIt, class Compare>
+OutputIt merge(InputIt1 first1, InputIt1 last1, InputIt2 first2,
+               InputIt2 last2, OutputIt d_first, Compare comp)
+{
+    for (; first1 != last1; ++d_first)
+    {
+        if (first2 == last2)
+            return copy(first1, last1, d_first);
+
+        if (comp(*first2, *first1))
+            *d_first = *first2++;
+        else
+            *d_first = *first1++;
+    }
+
+    return copy(first2, last2, d_first);
+}
+
+template<class InputIt1, class InputIt2, class OutputIt>
+OutputIt merge(InputIt1 first1, InputIt1 last1, InputIt2 first2,
+               InputIt2 last2, OutputIt d_first)
+{
+    return merge(first1, last1, first2, last2, d_first, less<>{});
+}
+
+// Stably merges the sorted ranges [first, middle) and [middle, last). The
+// elements of the shorter range are moved into [buffer_first, buffer_last)
+// if they fit, which merges in linear time. Otherwise the ranges are split
+// until the parts fit, down to an O(n log n) merge without any buffer. The
+// buffer must hold constructed objects, which are left in a moved-from state.
+template<class BidirIt, class BufferIt, class Compare>
+void inplace_merge(BidirIt first, BidirIt middle, BidirIt last,
+                   BufferIt buffer_first, BufferIt buffer_last, Compare comp)
+{
+    using distance_type = typename iterator_traits<BidirIt>::difference_type;
+
+    detail::merge_adaptive(first, middle, last, distance(first, middle),
+                           distance(middle, last), buffer_first,
+                           distance_type(distance(buffer_first, buffer_last)),
+                           comp);
+}
+
+template<class BidirIt, class BufferIt>
+void inplace_merge(BidirIt first, BidirIt middle, BidirIt last,
+                   BufferIt buffer_first, BufferIt buffer_last)
+{
+    inplace_merge(first, middle, last, buffer_first, buffer_last, less<>{});
+}
+
+// Unlike the standard one, this never allocates a buffer and always takes the
+// O(n log n) route. Pass a buffer to the overload above to merge in linear
+// time.
+template<class BidirIt, class Compare>
+void inplace_merge(BidirIt first, BidirIt middle, BidirIt last, Compare comp)
+{
+    detail::merge_without_buffer(first, middle, last, distance(first, middle),
+                                 distance(middle, last), comp);
+}
+
+template<class BidirIt>
+void inplace_merge(BidirIt first, BidirIt middle, BidirIt last)
+{
+    inplace_merge(first, middle, last, less<>{});
+}
+
+// The set operations take sorted ranges and run in linear time. An element
+// that occurs m times in the first range and n times in the second one is
+// treated as m and n distinct elements.
+template<class InputIt1, class InputIt2, class Compare>
+bool includes(InputIt1 first1, InputIt1 last1, InputIt2 first2,
+              InputIt2 last2, Compare comp)
+{
+    for (; first2 != last2; ++first1)
+    {
+        if (first1 == last1 || comp(*first2, *first1))
+            return false;
+
+        if (!comp(*first1, *first2))
+            ++first2;
+    }
+
+    return true;
+}
+
+template<class InputIt1, class InputIt2>
+bool includes(InputIt1 first1, InputIt1 last1, InputIt2 first2,
+              InputIt2 last2)
+{
+    return includes(first1, last1, first2, last2, less<>{});
+}
+
+template<class InputIt1, class InputIt2, class OutputIt, class Compare>
+OutputIt set_union(InputIt1 first1, InputIt1 last1, InputIt2 first2,
+                   InputIt2 last2, OutputIt d_first, Compare comp)
+{
+    for (; first1 != last1; ++d_first)
+    {
+        if (first2 == last2)
+            return copy(first1, last1, d_first);
+
+        if (comp(*first2, *first1))
+        {
+            *d_first = *first2++;
+        }
+        else
+        {
+            if (!comp(*first1, *first2))
+                ++first2;
+
+            *d_first = *first1++;
+        }
+    }
+
+    return copy(first2, last2, d_first);
+}
+
+template<class InputIt1, class InputIt2, class OutputIt>
+OutputIt set_union(InputIt1 first1, InputIt1 last1, InputIt2 first2,
+                   InputIt2 last2, OutputIt d_first)
+{
+    return set_union(first1, last1, first2, last2, d_first, less<>{});
+}
+
+template<class InputIt1, class InputIt2, class OutputIt, class Compare>
+OutputIt set_intersection(InputIt1 first1, InputIt1 last1, InputIt2 first2,
+                          InputIt2 last2, OutputIt d_first, Compare comp)
+{
+    while (first1 != last1 && first2 != last2)
+    {
+        if (comp(*first1, *first2))
+        {
+            ++first1;
+        }
+        else
+        {
+            if (!comp(*first2, *first1))
+                *d_first++ = *first1++;
+
+            ++first2;
+        }
+    }
+
+    return d_first;
+}
+
+template<class InputIt1, class InputIt2, class OutputIt>
+OutputIt set_intersection(InputIt1 first1, InputIt1 last1, InputIt2 first2,
+                          InputIt2 last2, OutputIt d_first)
+{
+    return set_intersection(first1, last1, first2, last2, d_first, less<>{});
+}
+
+template<class InputIt1, class InputIt2, class OutputIt, class Compare>
+OutputIt set_difference(InputIt1 first1, InputIt1 last1, InputIt2 first2,
+                        InputIt2 last2, OutputIt d_first, Compare comp)
+{
+    while (first1 != last1)
+    {
+        if (first2 == last2)
+            return copy(first1, last1, d_first);
+
+        if (comp(*first1, *first2))
+        {
+            *d_first++ = *first1++;
+        }
+        else
+        {
+            if (!comp(*first2, *first1))
+                ++first1;
+
+            ++first2;
+        }
+    }
+
+    return d_first;
+}
+
+template<class InputIt1, class InputIt2, class OutputIt>
+OutputIt set_difference(InputIt1 first1, InputIt1 last1, InputIt2 first2,
+                        InputIt2 last2, OutputIt d_first)
+{
+    return set_difference(first1, last1, first2, last2, d_first, less<>{});
+}
+
+template<class InputIt1, class InputIt2, class OutputIt, class Compare>
+OutputIt set_symmetric_difference(InputIt1 first1, InputIt1 last1,
+                                  InputIt2 first2, InputIt2 last2,
+                                  OutputIt d_first, Compare comp)
+{
+    while (first1 != last1)
+    {
+        if (first2 == last2)
+            return copy(first1, last1, d_first);
+
+        if (comp(*first1, *first2))
+        {
+            *d_first++ = *first1++;
+        }
+        else if (comp(*first2, *first1))
+        {
+            *d_first++ = *first2++;
+        }
+        else
+        {
+            ++first1;
+            ++first2;
+        }
+    }
+
+    return copy(first2, last2, d_first);
+}
+
+template<class InputIt1, class InputIt2, class OutputIt>
+OutputIt set_symmetric_difference(InputIt1 first1, InputIt1 last1,
+                                  InputIt2 first2, InputIt2 last2,
+                                  OutputIt d_first)
+{
+    return set_symmetric_difference(first1, last1, first2, last2, d_first,
+                                    less<>{});
+}
+
+// Sorts the middle - first smallest elements of [first, last) into
+// [first, middle) in O(n log k) comparisons, where k = middle - first. The
+// order of the remaining elements is unspecified.
+template<class RandomIt, class Compare>
+void partial_sort(RandomIt first, RandomIt middle, RandomIt last,
+                  Compare comp)
+{
+    auto size = middle - first;
+
+    if (size == 0)
+        return;
+
+    // Keep the smallest elements seen so far in a max-heap whose top is the
+    // next one to be replaced.
+    make_heap(first, middle, comp);
+
+    for (auto it = middle; it != last; ++it)
+    {
+        if (comp(*it, *first))
+        {
+            swap(*it, *first);
+            detail::sift_down(first, decltype(size){0}, size, comp);
+        }
+    }
+
+    sort_heap(first, middle, comp);
+}
+
+template<class RandomIt>
+void partial_sort(RandomIt first, RandomIt middle, RandomIt last)
+{
+    partial_sort(first, middle, last, less<>{});
+}
+
+// Like partial_sort() but leaves [first, last) alone and sorts the smallest
+// elements into [d_first, d_last) instead. Returns the end of the sorted
+// elements, which is before d_last if [first, last) is the shorter range.
+template<class InputIt, class RandomIt, class Compare>
+RandomIt partial_sort_copy(InputIt first, InputIt last,
+                           RandomIt d_first, RandomIt d_last, Compare comp)
+{
+    auto d_end = d_first;
+
+    for (; first != last && d_end != d_last; ++first, ++d_end)
+        *d_end = *first;
+
+    auto size = d_end - d_first;
+
+    if (size == 0)
+        return d_end;
+
+    make_heap(d_first, d_end, comp);
+
+    for (; first != last; ++first)
+    {
+        if (comp(*first, *d_first))
+        {
+            *d_first = *first;
+            detail::sift_down(d_first, decltype(size){0}, size, comp);
+        }
+    }
+
+    sort_heap(d_first, d_end, comp);
+    return d_end;
+}
+
+template<class InputIt, class RandomIt>
+RandomIt partial_sort_copy(InputIt first, InputIt last,
+                           RandomIt d_first, RandomIt d_last)
+{
+    return partial_sort_copy(first, last, d_first, d_last, less<>{});
+}
+
+namespace detail
+{
+
+template<class RandomIt, class Compare>
+void compare_exchange(RandomIt a, RandomIt b, Compare comp)
+{
+    if (comp(*b, *a))
+        swap(*a, *b);
+}
+
+// Sorts ranges of up to five elements with a fixed sequence of comparisons,
+// which for selecting e.g. the median of a tiny window is cheaper than any
+// partitioning.
+template<class RandomIt, class Compare>
+void sorting_network(RandomIt first, RandomIt last, Compare comp)
+{
+    auto e = [&](int i, int j) {compare_exchange(first + i, first + j, comp);};
+
+    switch (last - first)
+    {
+    case 2:
+        e(0, 1);
+        break;
+
+    case 3:
+        e(1, 2); e(0, 2); e(0, 1);
+        break;
+
+    case 4:
+        e(0, 1); e(2, 3); e(0, 2); e(1, 3); e(1, 2);
+        break;
+
+    case 5:
+        e(0, 1); e(3, 4); e(2, 4); e(2, 3); e(0, 3);
+        e(0, 2); e(1, 4); e(1, 3); e(1, 2);
+        break;
+    }
+}
+
+inline constexpr ptrdiff_t sorting_network_threshold = 5;
+
+// Quickselect that only keeps partitioning the part containing nth, so it
+// needs no recursion at all, and falls back to partial_sort() once
+// depth_limit partitions have been made to bound the running time to
+// O(n log n).
+template<class RandomIt, class Compare>
+void introselect(RandomIt first, RandomIt nth, RandomIt last, int depth_limit,
+                 Compare comp)
+{
+    while (last - first > sorting_network_threshold)
+    {
+        if (depth_limit-- == 0)
+        {
+            partial_sort(first, nth + 1, last, comp);
+            return;
+        }
+
+        auto cut = partition_around_median(first, last, comp);
+
+        if (cut <= nth)
+            first = cut;
+        else
+            last = cut;
+    }
+
+    sorting_network(first, last, comp);
+}
+
+} // namespace detail
+
+// Rearranges [first, last) such that *nth is the element that would be there
+// if the range was sorted, with no greater elements before it and no smaller
+// ones after it. Takes linear time on average, so picking the median of a
+// window of samples is cheaper than sorting it.
+template<class RandomIt, class Compare>
+void nth_element(RandomIt first, RandomIt nth, RandomIt last, Compare comp)
+{
+    if (nth == last)
+        return;
+
+    detail::introselect(first, nth, last, detail::depth_limit(last - first),
+                        comp);
+}
+
+template<class RandomIt>
+void nth_element(RandomIt first, RandomIt nth, RandomIt last)
+{
+    nth_element(first, nth, last, less<>{});
 }
 
 }
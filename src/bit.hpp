@@ -0,0 +1,37 @@
+#ifndef STDAVR_BIT_HPP
+#define STDAVR_BIT_HPP
+
+#include "namespace.hpp"
+#include "type_traits.hpp"
+
+namespace STDAVR_NAMESPACE
+{
+
+template<class T>
+constexpr int popcount(T x) noexcept
+{
+    if constexpr (sizeof(T) <= sizeof(unsigned))
+        return __builtin_popcount(x);
+    else if constexpr (sizeof(T) <= sizeof(unsigned long))
+        return __builtin_popcountl(x);
+    else
+        return __builtin_popcountll(x);
+}
+
+template<class T>
+constexpr int countr_zero(T x) noexcept
+{
+    if (x == 0)
+        return sizeof(T) * __CHAR_BIT__;
+
+    if constexpr (sizeof(T) <= sizeof(unsigned))
+        return __builtin_ctz(x);
+    else if constexpr (sizeof(T) <= sizeof(unsigned long))
+        return __builtin_ctzl(x);
+    else
+        return __builtin_ctzll(x);
+}
+
+}
+
+#endif
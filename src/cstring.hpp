@@ -0,0 +1,20 @@
+#ifndef STDAVR_CSTRING_HPP
+#define STDAVR_CSTRING_HPP
+
+#include "namespace.hpp"
+#include "cstddef.hpp"
+
+#include <string.h>
+
+namespace STDAVR_NAMESPACE
+{
+
+using ::memcpy;
+using ::memmove;
+using ::memset;
+using ::memcmp;
+using ::memchr;
+
+}
+
+#endif
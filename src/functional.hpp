@@ -0,0 +1,43 @@
+#ifndef STDAVR_FUNCTIONAL_HPP
+#define STDAVR_FUNCTIONAL_HPP
+
+#include "namespace.hpp"
+#include "utility.hpp"
+
+namespace STDAVR_NAMESPACE
+{
+
+// Defines the function object name<T> applying op to two Ts, and its
+// transparent specialization name<void> applying op to any two arguments.
+#define BINARY_FUNCTION_OBJECT(name, result_type, op)                       \
+    template<class T = void>                                                \
+    struct name                                                             \
+    {                                                                       \
+        constexpr result_type operator()(const T& lhs, const T& rhs) const  \
+        {                                                                   \
+            return lhs op rhs;                                              \
+        }                                                                   \
+    };                                                                      \
+    template<>                                                              \
+    struct name<void>                                                       \
+    {                                                                       \
+        template<class T, class U>                                          \
+        constexpr auto operator()(T&& lhs, U&& rhs) const                   \
+            -> decltype(forward<T>(lhs) op forward<U>(rhs))                 \
+        {                                                                   \
+            return forward<T>(lhs) op forward<U>(rhs);                      \
+        }                                                                   \
+    }
+
+BINARY_FUNCTION_OBJECT(plus, T, +);
+BINARY_FUNCTION_OBJECT(minus, T, -);
+BINARY_FUNCTION_OBJECT(multiplies, T, *);
+BINARY_FUNCTION_OBJECT(equal_to, bool, ==);
+BINARY_FUNCTION_OBJECT(less, bool, <);
+BINARY_FUNCTION_OBJECT(greater, bool, >);
+
+#undef BINARY_FUNCTION_OBJECT
+
+}
+
+#endif
@@ -0,0 +1,330 @@
+#ifndef STDAVR_INPLACE_VECTOR_HPP
+#define STDAVR_INPLACE_VECTOR_HPP
+
+#include "namespace.hpp"
+#include "utility.hpp"
+#include "memory.hpp"
+#include "type_traits.hpp"
+#include "initializer_list.hpp"
+#include "iterator.hpp"
+#include "cstddef.hpp"
+#include "cstdint.hpp"
+#include "cassert.hpp"
+#include "cstdlib.hpp"
+
+namespace STDAVR_NAMESPACE
+{
+
+namespace detail
+{
+
+// The smallest unsigned integer type that can represent N.
+template<size_t N>
+using smallest_unsigned_t =
+    conditional_t<N <= uint8_t(-1),  uint8_t,
+    conditional_t<N <= uint16_t(-1), uint16_t,
+    conditional_t<N <= uint32_t(-1), uint32_t,
+                                     uint64_t>>>;
+
+template<typename T, size_t N>
+struct inplace_vector_storage
+{
+    T* data() noexcept
+    {
+        return reinterpret_cast<T*>(bytes_);
+    }
+
+    const T* data() const noexcept
+    {
+        return reinterpret_cast<const T*>(bytes_);
+    }
+
+    alignas(T) unsigned char bytes_[(N == 0 ? 1 : N) * sizeof(T)];
+    smallest_unsigned_t<N> size_ = 0;
+};
+
+// When T is trivially copyable, so is the inplace_vector holding it: copying
+// the raw storage is a valid way to copy the elements and there is nothing to
+// destroy.
+template<typename T, size_t N, bool = is_trivially_copyable_v<T>>
+struct inplace_vector_base : inplace_vector_storage<T, N>
+{
+};
+
+template<typename T, size_t N>
+struct inplace_vector_base<T, N, false> : inplace_vector_storage<T, N>
+{
+    inplace_vector_base() = default;
+
+    inplace_vector_base(const inplace_vector_base& other)
+    {
+        uninitialized_copy(other.data(), other.data() + other.size_,
+                           this->data());
+        this->size_ = other.size_;
+    }
+
+    inplace_vector_base(inplace_vector_base&& other)
+        noexcept(is_nothrow_move_constructible_v<T>)
+    {
+        uninitialized_move(other.data(), other.data() + other.size_,
+                           this->data());
+        this->size_ = other.size_;
+    }
+
+    ~inplace_vector_base()
+    {
+        destroy(this->data(), this->data() + this->size_);
+    }
+
+    inplace_vector_base& operator=(const inplace_vector_base& other)
+    {
+        if (this != &other)
+        {
+            destroy(this->data(), this->data() + this->size_);
+            this->size_ = 0;
+            uninitialized_copy(other.data(), other.data() + other.size_,
+                               this->data());
+            this->size_ = other.size_;
+        }
+
+        return *this;
+    }
+
+    inplace_vector_base& operator=(inplace_vector_base&& other)
+        noexcept(is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other)
+        {
+            destroy(this->data(), this->data() + this->size_);
+            this->size_ = 0;
+            uninitialized_move(other.data(), other.data() + other.size_,
+                               this->data());
+            this->size_ = other.size_;
+        }
+
+        return *this;
+    }
+};
+
+} // namespace detail
+
+// A vector with a fixed capacity of N elements that are stored inside the
+// object itself, so it never touches the heap. Growing beyond N aborts.
+template<typename T, size_t N>
+class inplace_vector : detail::inplace_vector_base<T, N>
+{
+public:
+
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using iterator = value_type*;
+    using const_iterator = const value_type*;
+
+    inplace_vector() = default;
+
+    inplace_vector(size_type count, const T& value)
+    {
+        check_capacity(count);
+        uninitialized_fill_n(data(), count, value);
+        this->size_ = count;
+    }
+
+    explicit inplace_vector(size_type count)
+    {
+        check_capacity(count);
+        uninitialized_value_construct_n(data(), count);
+        this->size_ = count;
+    }
+
+    inplace_vector(std::initializer_list<T> il)
+        : inplace_vector(il.begin(), il.end())
+    {
+    }
+
+    template<typename InputIt,
+             typename = detail::require_input_iterator<InputIt>>
+    inplace_vector(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+            emplace_back(*first);
+    }
+
+    inplace_vector& operator=(std::initializer_list<T> il)
+    {
+        return *this = inplace_vector(il);
+    }
+
+    size_type size() const noexcept
+    {
+        return this->size_;
+    }
+
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    static constexpr size_type capacity() noexcept
+    {
+        return N;
+    }
+
+    static constexpr size_type max_size() noexcept
+    {
+        return N;
+    }
+
+    iterator begin() noexcept
+    {
+        return data();
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return data();
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    iterator end() noexcept
+    {
+        return data() + size();
+    }
+
+    const_iterator end() const noexcept
+    {
+        return data() + size();
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return end();
+    }
+
+    // Elements are stored inline so, unlike for vector, swapping has to move
+    // them one by one.
+    void swap(inplace_vector& other)
+    {
+        auto tmp = move(*this);
+        *this = move(other);
+        other = move(tmp);
+    }
+
+    reference front()
+    {
+        return const_cast<reference>(
+            const_cast<const inplace_vector*>(this)->front());
+    }
+
+    const_reference front() const
+    {
+        assert(!empty() && "front() called on empty inplace_vector");
+
+        return data()[0];
+    }
+
+    reference back()
+    {
+        return const_cast<reference>(
+            const_cast<const inplace_vector*>(this)->back());
+    }
+
+    const_reference back() const
+    {
+        assert(!empty() && "back() called on empty inplace_vector");
+
+        return data()[size() - 1];
+    }
+
+    reference operator[](size_type pos)
+    {
+        return const_cast<reference>(
+            const_cast<const inplace_vector&>(*this)[pos]);
+    }
+
+    const_reference operator[](size_type pos) const
+    {
+        assert(pos < size() && "operator[] index out of range");
+
+        return data()[pos];
+    }
+
+    reference at(size_type pos)
+    {
+        return const_cast<reference>(
+            const_cast<const inplace_vector*>(this)->at(pos));
+    }
+
+    const_reference at(size_type pos) const
+    {
+        if (pos >= size())
+            abort();
+
+        return (*this)[pos];
+    }
+
+    void push_back(const T& value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value)
+    {
+        emplace_back(move(value));
+    }
+
+    template<typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+        check_capacity(size() + 1);
+        construct_at(end(), forward<Args>(args)...);
+        ++this->size_;
+
+        return back();
+    }
+
+    void pop_back()
+    {
+        assert(!empty() && "pop_back() called on empty inplace_vector");
+
+        destroy_at(data() + --this->size_);
+    }
+
+    T* data() noexcept
+    {
+        return detail::inplace_vector_storage<T, N>::data();
+    }
+
+    const T* data() const noexcept
+    {
+        return detail::inplace_vector_storage<T, N>::data();
+    }
+
+private:
+
+    static void check_capacity(size_type count)
+    {
+        if (count > N)
+            abort();
+    }
+};
+
+template<class T, size_t N>
+void swap(inplace_vector<T, N>& lhs, inplace_vector<T, N>& rhs)
+{
+    lhs.swap(rhs);
+}
+
+template<class T, size_t N>
+struct is_trivially_relocatable<inplace_vector<T, N>>
+    : is_trivially_relocatable<T> {};
+
+}
+
+#endif
@@ -3,6 +3,7 @@
 
 #include "namespace.hpp"
 #include "type_traits.hpp"
+#include "utility.hpp"
 #include "cstddef.hpp"
 
 namespace STDAVR_NAMESPACE
@@ -61,10 +62,25 @@ struct output_iterator_tag {};
 struct forward_iterator_tag : input_iterator_tag {};
 struct bidirectional_iterator_tag : forward_iterator_tag {};
 struct random_access_iterator_tag : bidirectional_iterator_tag {};
+struct contiguous_iterator_tag : random_access_iterator_tag {};
 
 namespace detail
 {
 
+// Iterators may refine their iterator_category with an iterator_concept, which
+// is how contiguous iterators identify themselves.
+template<typename Iterator, typename = void_t<>>
+struct iterator_concept_traits
+{
+};
+
+template<typename Iterator>
+struct iterator_concept_traits<Iterator,
+                               void_t<typename Iterator::iterator_concept>>
+{
+    using iterator_concept = typename Iterator::iterator_concept;
+};
+
 template<typename Iterator, typename = void_t<>>
 struct iterator_class_traits
 {
@@ -77,6 +93,7 @@ struct iterator_class_traits<Iterator,
                                     typename Iterator::difference_type,
                                     typename Iterator::pointer,
                                     typename Iterator::reference>>
+    : iterator_concept_traits<Iterator>
 {
     using value_type        = typename Iterator::value_type;
     using difference_type   = typename Iterator::difference_type;
@@ -100,6 +117,7 @@ struct iterator_traits<T*>
     using pointer           = T*;
     using reference         = T&;
     using iterator_category = random_access_iterator_tag;
+    using iterator_concept  = contiguous_iterator_tag;
 };
 
 template<typename T>
@@ -110,6 +128,7 @@ struct iterator_traits<const T*>
     using pointer           = const T*;
     using reference         = const T&;
     using iterator_category = random_access_iterator_tag;
+    using iterator_concept  = contiguous_iterator_tag;
 };
 
 namespace detail
@@ -142,8 +161,621 @@ IS_X_ITERATOR(random_access);
 
 #undef IS_X_ITERATOR
 
+// Whether It is a pointer or an iterator with a contiguous_iterator_tag
+// iterator_concept, i.e. whether its elements lie next to each other in memory
+// so that ranges of them may be handed to memcpy and friends via to_address().
+template<typename It, typename = void>
+struct is_contiguous_iterator : false_type {};
+
+template<typename It>
+struct is_contiguous_iterator<
+    It,
+    enable_if_t<
+        is_base_of_v<contiguous_iterator_tag,
+                     typename iterator_traits<It>::iterator_concept>
+    >
+> : true_type {};
+
+template<typename It>
+inline constexpr bool is_contiguous_iterator_v =
+    is_contiguous_iterator<It>::value;
+
+template<typename... Its>
+using require_contiguous_iterators =
+    enable_if_t<(is_contiguous_iterator_v<Its> && ...)>;
+
+// The possibly const element type of the contiguous iterator It.
+template<typename It>
+using contiguous_element_t =
+    remove_reference_t<typename iterator_traits<It>::reference>;
+
+// Whether copying from a range of InputIt to OutputIt may be done with a single
+// memcpy/memmove instead of an element loop.
+template<typename InputIt, typename OutputIt, typename = void>
+inline constexpr bool is_bitwise_copyable_v = false;
+
+template<typename InputIt, typename OutputIt>
+inline constexpr bool is_bitwise_copyable_v<
+    InputIt, OutputIt, require_contiguous_iterators<InputIt, OutputIt>> =
+    is_same_v<remove_cv_t<contiguous_element_t<InputIt>>,
+              contiguous_element_t<OutputIt>> &&
+    is_trivially_copyable_v<contiguous_element_t<OutputIt>>;
+
 } // namespace detail
 
+template<class InputIt>
+constexpr typename iterator_traits<InputIt>::difference_type
+distance(InputIt first, InputIt last)
+{
+    if constexpr (detail::is_random_access_iterator_v<InputIt>)
+    {
+        return last - first;
+    }
+    else
+    {
+        typename iterator_traits<InputIt>::difference_type n = 0;
+
+        for (; first != last; ++first)
+            ++n;
+
+        return n;
+    }
+}
+
+// Moves it by n steps in constant time for random access iterators and in
+// linear time otherwise. n may only be negative for bidirectional iterators.
+template<class InputIt, class Distance>
+constexpr void advance(InputIt& it, Distance n)
+{
+    if constexpr (detail::is_random_access_iterator_v<InputIt>)
+    {
+        it += n;
+    }
+    else
+    {
+        if constexpr (detail::is_bidirectional_iterator_v<InputIt>)
+        {
+            for (; n < 0; ++n)
+                --it;
+        }
+
+        for (; n > 0; --n)
+            ++it;
+    }
+}
+
+template<class InputIt>
+constexpr InputIt
+next(InputIt it, typename iterator_traits<InputIt>::difference_type n = 1)
+{
+    advance(it, n);
+    return it;
+}
+
+template<class BidirIt>
+constexpr BidirIt
+prev(BidirIt it, typename iterator_traits<BidirIt>::difference_type n = 1)
+{
+    advance(it, -n);
+    return it;
+}
+
+// Traverses the range of a bidirectional iterator backwards. It refers to the
+// element before its base iterator so that reverse_iterator(end) refers to the
+// last element.
+template<class Iter>
+class reverse_iterator
+{
+    using base_category = typename iterator_traits<Iter>::iterator_category;
+
+public:
+
+    using iterator_type     = Iter;
+    using value_type        = typename iterator_traits<Iter>::value_type;
+    using difference_type   = typename iterator_traits<Iter>::difference_type;
+    using pointer           = typename iterator_traits<Iter>::pointer;
+    using reference         = typename iterator_traits<Iter>::reference;
+    using iterator_category =
+        conditional_t<is_base_of_v<random_access_iterator_tag, base_category>,
+                      random_access_iterator_tag, base_category>;
+
+    constexpr reverse_iterator() = default;
+
+    constexpr explicit reverse_iterator(Iter it) : current_{it}
+    {
+    }
+
+    template<class U>
+    constexpr reverse_iterator(const reverse_iterator<U>& other)
+        : current_{other.base()}
+    {
+    }
+
+    constexpr Iter base() const
+    {
+        return current_;
+    }
+
+    constexpr reference operator*() const
+    {
+        return *prev(current_);
+    }
+
+    constexpr pointer operator->() const
+    {
+        if constexpr (is_pointer_v<Iter>)
+            return current_ - 1;
+        else
+            return prev(current_).operator->();
+    }
+
+    constexpr reference operator[](difference_type n) const
+    {
+        return current_[-n - 1];
+    }
+
+    constexpr reverse_iterator& operator++()
+    {
+        --current_;
+        return *this;
+    }
+
+    constexpr reverse_iterator operator++(int)
+    {
+        auto tmp = *this;
+        --current_;
+        return tmp;
+    }
+
+    constexpr reverse_iterator& operator--()
+    {
+        ++current_;
+        return *this;
+    }
+
+    constexpr reverse_iterator operator--(int)
+    {
+        auto tmp = *this;
+        ++current_;
+        return tmp;
+    }
+
+    constexpr reverse_iterator& operator+=(difference_type n)
+    {
+        current_ -= n;
+        return *this;
+    }
+
+    constexpr reverse_iterator& operator-=(difference_type n)
+    {
+        current_ += n;
+        return *this;
+    }
+
+    constexpr reverse_iterator operator+(difference_type n) const
+    {
+        return reverse_iterator(current_ - n);
+    }
+
+    constexpr reverse_iterator operator-(difference_type n) const
+    {
+        return reverse_iterator(current_ + n);
+    }
+
+    friend constexpr reverse_iterator operator+(difference_type n,
+                                                const reverse_iterator& it)
+    {
+        return it + n;
+    }
+
+private:
+
+    Iter current_{};
+};
+
+template<class Iter1, class Iter2>
+constexpr bool operator==(const reverse_iterator<Iter1>& lhs,
+                          const reverse_iterator<Iter2>& rhs)
+{
+    return lhs.base() == rhs.base();
+}
+
+template<class Iter1, class Iter2>
+constexpr bool operator!=(const reverse_iterator<Iter1>& lhs,
+                          const reverse_iterator<Iter2>& rhs)
+{
+    return lhs.base() != rhs.base();
+}
+
+template<class Iter1, class Iter2>
+constexpr bool operator<(const reverse_iterator<Iter1>& lhs,
+                         const reverse_iterator<Iter2>& rhs)
+{
+    return lhs.base() > rhs.base();
+}
+
+template<class Iter1, class Iter2>
+constexpr bool operator>(const reverse_iterator<Iter1>& lhs,
+                         const reverse_iterator<Iter2>& rhs)
+{
+    return lhs.base() < rhs.base();
+}
+
+template<class Iter1, class Iter2>
+constexpr bool operator<=(const reverse_iterator<Iter1>& lhs,
+                          const reverse_iterator<Iter2>& rhs)
+{
+    return lhs.base() >= rhs.base();
+}
+
+template<class Iter1, class Iter2>
+constexpr bool operator>=(const reverse_iterator<Iter1>& lhs,
+                          const reverse_iterator<Iter2>& rhs)
+{
+    return lhs.base() <= rhs.base();
+}
+
+template<class Iter1, class Iter2>
+constexpr auto operator-(const reverse_iterator<Iter1>& lhs,
+                         const reverse_iterator<Iter2>& rhs)
+    -> decltype(rhs.base() - lhs.base())
+{
+    return rhs.base() - lhs.base();
+}
+
+template<class Iter>
+constexpr reverse_iterator<Iter> make_reverse_iterator(Iter it)
+{
+    return reverse_iterator<Iter>(it);
+}
+
+// Turns the elements of the underlying range into rvalues so that algorithms
+// and constructors taking it move instead of copying them. It keeps the
+// category and concept of the underlying iterator, so a move_iterator over a
+// contiguous range of trivially copyable elements is still copied with a
+// single memcpy.
+template<class Iter>
+class move_iterator : public detail::iterator_concept_traits<
+                          iterator_traits<Iter>>
+{
+    using base_reference = typename iterator_traits<Iter>::reference;
+
+public:
+
+    using iterator_type     = Iter;
+    using value_type        = typename iterator_traits<Iter>::value_type;
+    using difference_type   = typename iterator_traits<Iter>::difference_type;
+    using pointer           = Iter;
+    using reference         =
+        conditional_t<is_reference_v<base_reference>,
+                      remove_reference_t<base_reference>&&, base_reference>;
+    using iterator_category = typename iterator_traits<Iter>::iterator_category;
+
+    constexpr move_iterator() = default;
+
+    constexpr explicit move_iterator(Iter it) : current_{it}
+    {
+    }
+
+    template<class U>
+    constexpr move_iterator(const move_iterator<U>& other)
+        : current_{other.base()}
+    {
+    }
+
+    constexpr Iter base() const
+    {
+        return current_;
+    }
+
+    constexpr reference operator*() const
+    {
+        return static_cast<reference>(*current_);
+    }
+
+    constexpr pointer operator->() const
+    {
+        return current_;
+    }
+
+    constexpr reference operator[](difference_type n) const
+    {
+        return static_cast<reference>(current_[n]);
+    }
+
+    constexpr move_iterator& operator++()
+    {
+        ++current_;
+        return *this;
+    }
+
+    constexpr move_iterator operator++(int)
+    {
+        auto tmp = *this;
+        ++current_;
+        return tmp;
+    }
+
+    constexpr move_iterator& operator--()
+    {
+        --current_;
+        return *this;
+    }
+
+    constexpr move_iterator operator--(int)
+    {
+        auto tmp = *this;
+        --current_;
+        return tmp;
+    }
+
+    constexpr move_iterator& operator+=(difference_type n)
+    {
+        current_ += n;
+        return *this;
+    }
+
+    constexpr move_iterator& operator-=(difference_type n)
+    {
+        current_ -= n;
+        return *this;
+    }
+
+    constexpr move_iterator operator+(difference_type n) const
+    {
+        return move_iterator(current_ + n);
+    }
+
+    constexpr move_iterator operator-(difference_type n) const
+    {
+        return move_iterator(current_ - n);
+    }
+
+    friend constexpr move_iterator operator+(difference_type n,
+                                             const move_iterator& it)
+    {
+        return it + n;
+    }
+
+private:
+
+    Iter current_{};
+};
+
+template<class Iter1, class Iter2>
+constexpr bool operator==(const move_iterator<Iter1>& lhs,
+                          const move_iterator<Iter2>& rhs)
+{
+    return lhs.base() == rhs.base();
+}
+
+template<class Iter1, class Iter2>
+constexpr bool operator!=(const move_iterator<Iter1>& lhs,
+                          const move_iterator<Iter2>& rhs)
+{
+    return lhs.base() != rhs.base();
+}
+
+template<class Iter1, class Iter2>
+constexpr bool operator<(const move_iterator<Iter1>& lhs,
+                         const move_iterator<Iter2>& rhs)
+{
+    return lhs.base() < rhs.base();
+}
+
+template<class Iter1, class Iter2>
+constexpr bool operator>(const move_iterator<Iter1>& lhs,
+                         const move_iterator<Iter2>& rhs)
+{
+    return lhs.base() > rhs.base();
+}
+
+template<class Iter1, class Iter2>
+constexpr bool operator<=(const move_iterator<Iter1>& lhs,
+                          const move_iterator<Iter2>& rhs)
+{
+    return lhs.base() <= rhs.base();
+}
+
+template<class Iter1, class Iter2>
+constexpr bool operator>=(const move_iterator<Iter1>& lhs,
+                          const move_iterator<Iter2>& rhs)
+{
+    return lhs.base() >= rhs.base();
+}
+
+template<class Iter1, class Iter2>
+constexpr auto operator-(const move_iterator<Iter1>& lhs,
+                         const move_iterator<Iter2>& rhs)
+    -> decltype(lhs.base() - rhs.base())
+{
+    return lhs.base() - rhs.base();
+}
+
+template<class Iter>
+constexpr move_iterator<Iter> make_move_iterator(Iter it)
+{
+    return move_iterator<Iter>(it);
+}
+
+// The insert iterators are output iterators that add every element assigned
+// through them to a container, with push_back(), push_front() or insert()
+// respectively.
+template<class Container>
+class back_insert_iterator
+{
+public:
+
+    using container_type    = Container;
+    using value_type        = void;
+    using difference_type   = ptrdiff_t;
+    using pointer           = void;
+    using reference         = void;
+    using iterator_category = output_iterator_tag;
+
+    constexpr explicit back_insert_iterator(Container& c)
+        : container{__builtin_addressof(c)}
+    {
+    }
+
+    constexpr back_insert_iterator&
+    operator=(const typename Container::value_type& value)
+    {
+        container->push_back(value);
+        return *this;
+    }
+
+    constexpr back_insert_iterator&
+    operator=(typename Container::value_type&& value)
+    {
+        container->push_back(move(value));
+        return *this;
+    }
+
+    constexpr back_insert_iterator& operator*()
+    {
+        return *this;
+    }
+
+    constexpr back_insert_iterator& operator++()
+    {
+        return *this;
+    }
+
+    constexpr back_insert_iterator operator++(int)
+    {
+        return *this;
+    }
+
+protected:
+
+    Container* container;
+};
+
+template<class Container>
+constexpr back_insert_iterator<Container> back_inserter(Container& c)
+{
+    return back_insert_iterator<Container>(c);
+}
+
+template<class Container>
+class front_insert_iterator
+{
+public:
+
+    using container_type    = Container;
+    using value_type        = void;
+    using difference_type   = ptrdiff_t;
+    using pointer           = void;
+    using reference         = void;
+    using iterator_category = output_iterator_tag;
+
+    constexpr explicit front_insert_iterator(Container& c)
+        : container{__builtin_addressof(c)}
+    {
+    }
+
+    constexpr front_insert_iterator&
+    operator=(const typename Container::value_type& value)
+    {
+        container->push_front(value);
+        return *this;
+    }
+
+    constexpr front_insert_iterator&
+    operator=(typename Container::value_type&& value)
+    {
+        container->push_front(move(value));
+        return *this;
+    }
+
+    constexpr front_insert_iterator& operator*()
+    {
+        return *this;
+    }
+
+    constexpr front_insert_iterator& operator++()
+    {
+        return *this;
+    }
+
+    constexpr front_insert_iterator operator++(int)
+    {
+        return *this;
+    }
+
+protected:
+
+    Container* container;
+};
+
+template<class Container>
+constexpr front_insert_iterator<Container> front_inserter(Container& c)
+{
+    return front_insert_iterator<Container>(c);
+}
+
+template<class Container>
+class insert_iterator
+{
+public:
+
+    using container_type    = Container;
+    using value_type        = void;
+    using difference_type   = ptrdiff_t;
+    using pointer           = void;
+    using reference         = void;
+    using iterator_category = output_iterator_tag;
+
+    constexpr insert_iterator(Container& c, typename Container::iterator it)
+        : container{__builtin_addressof(c)}, iter{it}
+    {
+    }
+
+    constexpr insert_iterator&
+    operator=(const typename Container::value_type& value)
+    {
+        iter = container->insert(iter, value);
+        ++iter;
+        return *this;
+    }
+
+    constexpr insert_iterator&
+    operator=(typename Container::value_type&& value)
+    {
+        iter = container->insert(iter, move(value));
+        ++iter;
+        return *this;
+    }
+
+    constexpr insert_iterator& operator*()
+    {
+        return *this;
+    }
+
+    constexpr insert_iterator& operator++()
+    {
+        return *this;
+    }
+
+    constexpr insert_iterator& operator++(int)
+    {
+        return *this;
+    }
+
+protected:
+
+    Container* container;
+    typename Container::iterator iter;
+};
+
+template<class Container>
+constexpr insert_iterator<Container>
+inserter(Container& c, typename Container::iterator it)
+{
+    return insert_iterator<Container>(c, it);
+}
+
 }
 
 #endif
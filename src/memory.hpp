@@ -0,0 +1,370 @@
+#ifndef STDAVR_MEMORY_HPP
+#define STDAVR_MEMORY_HPP
+
+#include "namespace.hpp"
+#include "type_traits.hpp"
+#include "utility.hpp"
+#include "iterator.hpp"
+#include "cstddef.hpp"
+#include "cstring.hpp"
+#include "cstdlib.hpp"
+
+namespace STDAVR_NAMESPACE
+{
+
+template<class T>
+constexpr T* addressof(T& arg) noexcept
+{
+    return __builtin_addressof(arg);
+}
+
+// Returns the raw pointer that p, a pointer or a contiguous iterator, refers
+// to. Unlike dereferencing it, this is fine for past-the-end iterators.
+template<class T>
+constexpr T* to_address(T* p) noexcept
+{
+    return p;
+}
+
+template<class Ptr>
+constexpr auto to_address(const Ptr& p) noexcept
+{
+    return to_address(p.operator->());
+}
+
+template<class T, class... Args>
+T* construct_at(T* p, Args&&... args)
+{
+    return ::new (static_cast<void*>(p)) T(forward<Args>(args)...);
+}
+
+template<class T>
+void destroy_at(T* p)
+{
+    p->~T();
+}
+
+template<class ForwardIt>
+void destroy(ForwardIt first, ForwardIt last)
+{
+    using value_type = typename iterator_traits<ForwardIt>::value_type;
+
+    // Make sure not even the iteration is left behind when there is nothing to
+    // destroy.
+    if constexpr (!is_trivially_destructible_v<value_type>)
+    {
+        for (; first != last; ++first)
+            destroy_at(addressof(*first));
+    }
+}
+
+namespace detail
+{
+
+// Calls rollback when destroyed unless release() was called first. This undoes
+// the steps of an operation that was cut short by an exception, such as
+// destroying the objects an uninitialized algorithm already constructed.
+template<class Rollback>
+class rollback_guard
+{
+public:
+
+    explicit rollback_guard(Rollback rollback)
+        : rollback_{rollback}, released_{false}
+    {
+    }
+
+    rollback_guard(const rollback_guard&) = delete;
+    rollback_guard& operator=(const rollback_guard&) = delete;
+
+    ~rollback_guard()
+    {
+        if (!released_)
+            rollback_();
+    }
+
+    void release() noexcept
+    {
+        released_ = true;
+    }
+
+private:
+
+    Rollback rollback_;
+    bool released_;
+};
+
+} // namespace detail
+
+template<class InputIt, class ForwardIt>
+ForwardIt uninitialized_copy(InputIt first, InputIt last, ForwardIt d_first)
+{
+    if constexpr (detail::is_bitwise_copyable_v<InputIt, ForwardIt>)
+    {
+        auto count = last - first;
+
+        if (count > 0)
+            memcpy(to_address(d_first), to_address(first),
+                   count * sizeof(*first));
+
+        return d_first + count;
+    }
+    else
+    {
+        auto cur = d_first;
+        detail::rollback_guard guard{[&] {destroy(d_first, cur);}};
+
+        for (; first != last; ++first, ++cur)
+            construct_at(addressof(*cur), *first);
+
+        guard.release();
+        return cur;
+    }
+}
+
+template<class InputIt, class ForwardIt>
+ForwardIt uninitialized_move(InputIt first, InputIt last, ForwardIt d_first)
+{
+    if constexpr (detail::is_bitwise_copyable_v<InputIt, ForwardIt>)
+    {
+        return uninitialized_copy(first, last, d_first);
+    }
+    else
+    {
+        auto cur = d_first;
+        detail::rollback_guard guard{[&] {destroy(d_first, cur);}};
+
+        for (; first != last; ++first, ++cur)
+            construct_at(addressof(*cur), move(*first));
+
+        guard.release();
+        return cur;
+    }
+}
+
+template<class ForwardIt, class Size, class T>
+ForwardIt uninitialized_fill_n(ForwardIt first, Size count, const T& value)
+{
+    using value_type = typename iterator_traits<ForwardIt>::value_type;
+
+    if constexpr (detail::is_contiguous_iterator_v<ForwardIt> &&
+                  sizeof(value_type) == 1 &&
+                  is_same_v<remove_cv_t<T>, value_type> &&
+                  is_trivially_copyable_v<value_type>)
+    {
+        if (count <= 0)
+            return first;
+
+        unsigned char byte;
+        memcpy(&byte, addressof(value), 1);
+        memset(to_address(first), byte, count);
+        return first + count;
+    }
+    else
+    {
+        auto cur = first;
+        detail::rollback_guard guard{[&] {destroy(first, cur);}};
+
+        for (; count > 0; --count, ++cur)
+            construct_at(addressof(*cur), value);
+
+        guard.release();
+        return cur;
+    }
+}
+
+template<class ForwardIt, class Size>
+ForwardIt uninitialized_value_construct_n(ForwardIt first, Size count)
+{
+    using value_type = typename iterator_traits<ForwardIt>::value_type;
+
+    // Value-initializing a trivial type zero-initializes it.
+    if constexpr (detail::is_contiguous_iterator_v<ForwardIt> &&
+                  is_trivial_v<value_type>)
+    {
+        if (count <= 0)
+            return first;
+
+        memset(to_address(first), 0, count * sizeof(value_type));
+        return first + count;
+    }
+    else
+    {
+        auto cur = first;
+        detail::rollback_guard guard{[&] {destroy(first, cur);}};
+
+        for (; count > 0; --count, ++cur)
+            construct_at(addressof(*cur));
+
+        guard.release();
+        return cur;
+    }
+}
+
+template<class T>
+struct allocator
+{
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+
+    template<class U>
+    struct rebind {using other = allocator<U>;};
+
+    constexpr allocator() noexcept = default;
+
+    template<class U>
+    constexpr allocator(const allocator<U>&) noexcept
+    {
+    }
+
+    T* allocate(size_t n)
+    {
+        return static_cast<T*>(::operator new[](n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_t)
+    {
+        ::operator delete[](static_cast<void*>(p));
+    }
+};
+
+template<class T, class U>
+constexpr bool operator==(const allocator<T>&, const allocator<U>&) noexcept
+{
+    return true;
+}
+
+template<class T, class U>
+constexpr bool operator!=(const allocator<T>&, const allocator<U>&) noexcept
+{
+    return false;
+}
+
+namespace detail
+{
+
+// Moves [first, last) into uninitialized memory starting at d_first. Elements
+// are copied instead when their move constructor might throw so that the
+// source range is left intact in that case. This is the building block for
+// growing containers. Like the other uninitialized algorithms, it destroys
+// the objects it already constructed if a constructor throws.
+template<class InputIt, class ForwardIt>
+ForwardIt uninitialized_move_if_noexcept(InputIt first, InputIt last,
+                                         ForwardIt d_first)
+{
+    if constexpr (is_bitwise_copyable_v<InputIt, ForwardIt>)
+    {
+        return uninitialized_copy(first, last, d_first);
+    }
+    else
+    {
+        auto cur = d_first;
+        rollback_guard guard{[&] {destroy(d_first, cur);}};
+
+        for (; first != last; ++first, ++cur)
+            construct_at(addressof(*cur), move_if_noexcept(*first));
+
+        guard.release();
+        return cur;
+    }
+}
+
+// Relocates the objects in [first, last) to d_first: each object is moved to
+// its new location and the original is destroyed. The ranges may overlap as
+// long as d_first is not inside [first, last). Trivially relocatable objects
+// are relocated with a single memmove.
+template<class T>
+T* relocate(T* first, T* last, T* d_first)
+{
+    if constexpr (is_trivially_relocatable_v<T>)
+    {
+        auto count = last - first;
+
+        if (count > 0)
+            memmove(static_cast<void*>(d_first), first, count * sizeof(T));
+
+        return d_first + count;
+    }
+    else
+    {
+        for (; first != last; ++first, ++d_first)
+        {
+            construct_at(d_first, move(*first));
+            destroy_at(first);
+        }
+
+        return d_first;
+    }
+}
+
+// Like relocate() but relocates the objects to the range ending at d_last,
+// starting from the back. The ranges may overlap as long as d_last is not
+// inside [first, last).
+template<class T>
+T* relocate_backward(T* first, T* last, T* d_last)
+{
+    if constexpr (is_trivially_relocatable_v<T>)
+    {
+        auto count = last - first;
+
+        if (count > 0)
+            memmove(static_cast<void*>(d_last - count), first,
+                    count * sizeof(T));
+
+        return d_last - count;
+    }
+    else
+    {
+        while (last != first)
+        {
+            construct_at(--d_last, move(*--last));
+            destroy_at(last);
+        }
+
+        return d_last;
+    }
+}
+
+// Moves the objects in [first, last) to the uninitialized storage at d_first
+// when a container switches to new storage, leaving no objects behind to
+// destroy. Trivially relocatable objects are relocated. Other objects are
+// moved, or copied if their move constructor might throw, before the
+// originals are destroyed, so the source range is intact if this throws.
+template<class T>
+T* relocate_if_noexcept(T* first, T* last, T* d_first)
+{
+    if constexpr (is_trivially_relocatable_v<T>)
+    {
+        return relocate(first, last, d_first);
+    }
+    else
+    {
+        auto d_last = uninitialized_move_if_noexcept(first, last, d_first);
+        destroy(first, last);
+        return d_last;
+    }
+}
+
+// Returns the capacity for a container that is full at capacity to grow to.
+// It grows geometrically but saturates at max_size so that the full range of
+// the size type can be used. Aborts if capacity is max_size already.
+template<class Size>
+Size grown_capacity(Size capacity, Size max_size) noexcept
+{
+    if (capacity == max_size)
+        abort();
+
+    if (capacity == 0)
+        return 1;
+    else if (capacity > max_size / 2)
+        return max_size;
+    else
+        return 2 * capacity;
+}
+
+} // namespace detail
+
+} // namespace STDAVR_NAMESPACE
+
+#endif
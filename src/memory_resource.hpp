@@ -0,0 +1,136 @@
+#ifndef STDAVR_MEMORY_RESOURCE_HPP
+#define STDAVR_MEMORY_RESOURCE_HPP
+
+#include "namespace.hpp"
+#include "cstddef.hpp"
+#include "cstdint.hpp"
+#include "cstdlib.hpp"
+
+namespace STDAVR_NAMESPACE
+{
+
+// Hands out memory from a caller-supplied buffer by bumping a pointer.
+// Deallocation is a no-op; all memory is reclaimed at once by release().
+// Running out of buffer space aborts.
+//
+// Unlike std::pmr::monotonic_buffer_resource, this is not polymorphic and
+// never falls back to the heap.
+class monotonic_buffer_resource
+{
+public:
+
+    monotonic_buffer_resource(void* buffer, size_t size) noexcept
+        : begin_{static_cast<unsigned char*>(buffer)},
+          current_{begin_}, end_{begin_ + size}
+    {
+    }
+
+    template<size_t N>
+    explicit monotonic_buffer_resource(unsigned char (&buffer)[N]) noexcept
+        : monotonic_buffer_resource(buffer, N)
+    {
+    }
+
+    monotonic_buffer_resource(const monotonic_buffer_resource&) = delete;
+    monotonic_buffer_resource& operator=(
+        const monotonic_buffer_resource&) = delete;
+
+    void* allocate(size_t bytes, size_t alignment = alignof(max_align_t))
+    {
+        auto address = reinterpret_cast<uintptr_t>(current_);
+        auto padding = -address & (alignment - 1);
+
+        if (padding + bytes > size_t(end_ - current_))
+            abort();
+
+        auto p = current_ + padding;
+        current_ = p + bytes;
+        return p;
+    }
+
+    void deallocate(void*, size_t, size_t = alignof(max_align_t)) noexcept
+    {
+    }
+
+    // Makes the whole buffer available again. Any memory handed out before
+    // must not be used anymore.
+    void release() noexcept
+    {
+        current_ = begin_;
+    }
+
+    size_t remaining() const noexcept
+    {
+        return end_ - current_;
+    }
+
+private:
+
+    unsigned char* begin_;
+    unsigned char* current_;
+    unsigned char* end_;
+};
+
+// An allocator that allocates from a monotonic_buffer_resource. Meant for
+// short-lived containers whose memory can be reclaimed all at once, e.g., at
+// the end of each iteration of a control loop.
+template<class T>
+class arena_allocator
+{
+public:
+
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+
+    template<class U>
+    struct rebind {using other = arena_allocator<U>;};
+
+    arena_allocator(monotonic_buffer_resource& resource) noexcept
+        : resource_{&resource}
+    {
+    }
+
+    template<class U>
+    arena_allocator(const arena_allocator<U>& other) noexcept
+        : resource_{other.resource()}
+    {
+    }
+
+    T* allocate(size_t n)
+    {
+        return static_cast<T*>(resource_->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, size_t n) noexcept
+    {
+        resource_->deallocate(p, n * sizeof(T), alignof(T));
+    }
+
+    monotonic_buffer_resource* resource() const noexcept
+    {
+        return resource_;
+    }
+
+private:
+
+    monotonic_buffer_resource* resource_;
+};
+
+template<class T, class U>
+bool operator==(const arena_allocator<T>& lhs,
+                const arena_allocator<U>& rhs) noexcept
+{
+    return lhs.resource() == rhs.resource();
+}
+
+template<class T, class U>
+bool operator!=(const arena_allocator<T>& lhs,
+                const arena_allocator<U>& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+}
+
+#endif
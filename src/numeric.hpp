@@ -0,0 +1,352 @@
+#ifndef STDAVR_NUMERIC_HPP
+#define STDAVR_NUMERIC_HPP
+
+#include "namespace.hpp"
+#include "utility.hpp"
+#include "functional.hpp"
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "bit.hpp"
+#include "cstddef.hpp"
+
+namespace STDAVR_NAMESPACE
+{
+
+namespace detail
+{
+
+// The number of elements per iteration of the unrolled loops over contiguous
+// ranges. Short loop bodies are dominated by the increment, compare and branch
+// on AVR.
+inline constexpr ptrdiff_t unroll_factor = 4;
+
+// Reduces element(0), ..., element(size - 1) into init with op, which must be
+// associative and commutative. Four independent partial results are kept so
+// consecutive operations do not depend on each other.
+template<class T, class BinaryOp, class Element>
+T unrolled_reduce(ptrdiff_t size, T init, BinaryOp op, Element element)
+{
+    ptrdiff_t i = 0;
+
+    if (size >= unroll_factor)
+    {
+        T sum0 = element(0);
+        T sum1 = element(1);
+        T sum2 = element(2);
+        T sum3 = element(3);
+
+        for (i = unroll_factor; size - i >= unroll_factor; i += unroll_factor)
+        {
+            sum0 = op(move(sum0), element(i));
+            sum1 = op(move(sum1), element(i + 1));
+            sum2 = op(move(sum2), element(i + 2));
+            sum3 = op(move(sum3), element(i + 3));
+        }
+
+        init = op(move(init), op(op(move(sum0), move(sum1)),
+                                 op(move(sum2), move(sum3))));
+    }
+
+    for (; i < size; ++i)
+        init = op(move(init), element(i));
+
+    return init;
+}
+
+template<class T>
+constexpr T abs(T x)
+{
+    return x < 0 ? T(-x) : x;
+}
+
+template<class M, class N>
+using common_integer_t = decltype(true ? M() : N());
+
+} // namespace detail
+
+// Folds the range from left to right. Contiguous ranges are unrolled without
+// changing the order of the operations, so op need not be associative.
+template<class InputIt, class T, class BinaryOp>
+T accumulate(InputIt first, InputIt last, T init, BinaryOp op)
+{
+    if constexpr (detail::is_contiguous_iterator_v<InputIt>)
+    {
+        for (; last - first >= detail::unroll_factor;
+             first += detail::unroll_factor)
+        {
+            init = op(move(init), first[0]);
+            init = op(move(init), first[1]);
+            init = op(move(init), first[2]);
+            init = op(move(init), first[3]);
+        }
+    }
+
+    for (; first != last; ++first)
+        init = op(move(init), *first);
+
+    return init;
+}
+
+template<class InputIt, class T>
+T accumulate(InputIt first, InputIt last, T init)
+{
+    return accumulate(first, last, move(init), plus<>{});
+}
+
+// Like accumulate() but op may be applied in any order, which allows
+// contiguous ranges to be summed with independent partial results.
+template<class InputIt, class T, class BinaryOp>
+T reduce(InputIt first, InputIt last, T init, BinaryOp op)
+{
+    if constexpr (detail::is_contiguous_iterator_v<InputIt>)
+    {
+        return detail::unrolled_reduce(last - first, move(init), op,
+                                       [=](ptrdiff_t i) {return first[i];});
+    }
+    else
+    {
+        return accumulate(first, last, move(init), op);
+    }
+}
+
+template<class InputIt, class T>
+T reduce(InputIt first, InputIt last, T init)
+{
+    return reduce(first, last, move(init), plus<>{});
+}
+
+template<class InputIt>
+typename iterator_traits<InputIt>::value_type
+reduce(InputIt first, InputIt last)
+{
+    return reduce(first, last,
+                  typename iterator_traits<InputIt>::value_type{});
+}
+
+template<class InputIt, class T, class BinaryReduceOp, class UnaryTransformOp>
+T transform_reduce(InputIt first, InputIt last, T init,
+                   BinaryReduceOp reduce_op, UnaryTransformOp transform_op)
+{
+    if constexpr (detail::is_contiguous_iterator_v<InputIt>)
+    {
+        return detail::unrolled_reduce(last - first, move(init), reduce_op,
+                                       [=](ptrdiff_t i) {
+                                           return transform_op(first[i]);
+                                       });
+    }
+    else
+    {
+        for (; first != last; ++first)
+            init = reduce_op(move(init), transform_op(*first));
+
+        return init;
+    }
+}
+
+template<class InputIt1, class InputIt2, class T, class BinaryReduceOp,
+         class BinaryTransformOp>
+T transform_reduce(InputIt1 first1, InputIt1 last1, InputIt2 first2, T init,
+                   BinaryReduceOp reduce_op, BinaryTransformOp transform_op)
+{
+    if constexpr (detail::is_contiguous_iterator_v<InputIt1> &&
+                  detail::is_contiguous_iterator_v<InputIt2>)
+    {
+        return detail::unrolled_reduce(last1 - first1, move(init), reduce_op,
+                                       [=](ptrdiff_t i) {
+                                           return transform_op(first1[i],
+                                                               first2[i]);
+                                       });
+    }
+    else
+    {
+        for (; first1 != last1; ++first1, ++first2)
+            init = reduce_op(move(init), transform_op(*first1, *first2));
+
+        return init;
+    }
+}
+
+// The dot product of the two ranges, with the products summed in any order.
+template<class InputIt1, class InputIt2, class T>
+T transform_reduce(InputIt1 first1, InputIt1 last1, InputIt2 first2, T init)
+{
+    return transform_reduce(first1, last1, first2, move(init), plus<>{},
+                            multiplies<>{});
+}
+
+// Like the dot product overload of transform_reduce() but strictly from left
+// to right. Contiguous ranges are unrolled without changing that order.
+template<class InputIt1, class InputIt2, class T, class BinaryOp1,
+         class BinaryOp2>
+T inner_product(InputIt1 first1, InputIt1 last1, InputIt2 first2, T init,
+                BinaryOp1 op1, BinaryOp2 op2)
+{
+    if constexpr (detail::is_contiguous_iterator_v<InputIt1> &&
+                  detail::is_contiguous_iterator_v<InputIt2>)
+    {
+        for (; last1 - first1 >= detail::unroll_factor;
+             first1 += detail::unroll_factor, first2 += detail::unroll_factor)
+        {
+            init = op1(move(init), op2(first1[0], first2[0]));
+            init = op1(move(init), op2(first1[1], first2[1]));
+            init = op1(move(init), op2(first1[2], first2[2]));
+            init = op1(move(init), op2(first1[3], first2[3]));
+        }
+    }
+
+    for (; first1 != last1; ++first1, ++first2)
+        init = op1(move(init), op2(*first1, *first2));
+
+    return init;
+}
+
+template<class InputIt1, class InputIt2, class T>
+T inner_product(InputIt1 first1, InputIt1 last1, InputIt2 first2, T init)
+{
+    return inner_product(first1, last1, first2, move(init), plus<>{},
+                         multiplies<>{});
+}
+
+template<class InputIt, class OutputIt, class BinaryOp>
+OutputIt partial_sum(InputIt first, InputIt last, OutputIt d_first,
+                     BinaryOp op)
+{
+    if (first == last)
+        return d_first;
+
+    typename iterator_traits<InputIt>::value_type sum = *first;
+    *d_first = sum;
+
+    while (++first != last)
+    {
+        sum = op(move(sum), *first);
+        *++d_first = sum;
+    }
+
+    return ++d_first;
+}
+
+template<class InputIt, class OutputIt>
+OutputIt partial_sum(InputIt first, InputIt last, OutputIt d_first)
+{
+    return partial_sum(first, last, d_first, plus<>{});
+}
+
+template<class InputIt, class OutputIt, class BinaryOp>
+OutputIt adjacent_difference(InputIt first, InputIt last, OutputIt d_first,
+                             BinaryOp op)
+{
+    if (first == last)
+        return d_first;
+
+    typename iterator_traits<InputIt>::value_type previous = *first;
+    *d_first = previous;
+
+    while (++first != last)
+    {
+        typename iterator_traits<InputIt>::value_type current = *first;
+        *++d_first = op(current, move(previous));
+        previous = move(current);
+    }
+
+    return ++d_first;
+}
+
+template<class InputIt, class OutputIt>
+OutputIt adjacent_difference(InputIt first, InputIt last, OutputIt d_first)
+{
+    return adjacent_difference(first, last, d_first, minus<>{});
+}
+
+template<class ForwardIt, class T>
+void iota(ForwardIt first, ForwardIt last, T value)
+{
+    for (; first != last; ++first, ++value)
+        *first = value;
+}
+
+// Uses Stein's binary algorithm, which only needs shifts and subtractions
+// instead of the divisions of Euclid's algorithm that AVR has to do in
+// software.
+template<class M, class N>
+constexpr detail::common_integer_t<M, N> gcd(M m, N n)
+{
+    using T = detail::common_integer_t<M, N>;
+    static_assert(is_integral_v<T> && !is_same_v<T, bool>,
+                  "gcd() requires integers");
+
+    auto a = make_unsigned_t<T>(detail::abs(T(m)));
+    auto b = make_unsigned_t<T>(detail::abs(T(n)));
+
+    if (a == 0)
+        return T(b);
+
+    if (b == 0)
+        return T(a);
+
+    auto shift = countr_zero(a | b);
+    a >>= countr_zero(a);
+
+    do
+    {
+        b >>= countr_zero(b);
+
+        if (a > b)
+        {
+            auto tmp = a;
+            a = b;
+            b = tmp;
+        }
+
+        b -= a;
+    }
+    while (b != 0);
+
+    return T(a << shift);
+}
+
+template<class M, class N>
+constexpr detail::common_integer_t<M, N> lcm(M m, N n)
+{
+    using T = detail::common_integer_t<M, N>;
+
+    if (m == 0 || n == 0)
+        return 0;
+
+    return T(detail::abs(T(m)) / gcd(m, n) * detail::abs(T(n)));
+}
+
+// Returns the point halfway between a and b without overflowing. Integers are
+// rounded towards a.
+template<class T>
+constexpr T midpoint(T a, T b) noexcept
+{
+    static_assert(is_integral_v<T> || is_floating_point_v<T>,
+                  "midpoint() requires integers or floating point numbers");
+
+    if constexpr (is_integral_v<T>)
+    {
+        using U = make_unsigned_t<T>;
+
+        return a > b ? T(a - T(U(U(a) - U(b)) / 2))
+                     : T(a + T(U(U(b) - U(a)) / 2));
+    }
+    else
+    {
+        // Halve the operands before adding them only when their sum would
+        // overflow, since halving loses precision for tiny numbers.
+        auto sum = a + b;
+
+        return sum - sum == 0 ? sum / 2 : a / 2 + b / 2;
+    }
+}
+
+template<class T>
+constexpr T* midpoint(T* a, T* b)
+{
+    return a + (b - a) / 2;
+}
+
+}
+
+#endif
@@ -0,0 +1,126 @@
+#ifndef STDAVR_QUEUE_HPP
+#define STDAVR_QUEUE_HPP
+
+#include "namespace.hpp"
+#include "utility.hpp"
+#include "functional.hpp"
+#include "algorithm.hpp"
+#include "vector.hpp"
+
+namespace STDAVR_NAMESPACE
+{
+
+// Keeps the elements of Container arranged as a heap such that top() is the
+// greatest element with respect to Compare in O(1), while push() and pop() take
+// O(log n). Container must provide random access iterators, front(),
+// push_back(), emplace_back() and pop_back(), as vector, inplace_vector and
+// small_vector do, so a fixed capacity container keeps the queue off the heap.
+template<class T, class Container = vector<T>,
+         class Compare = less<typename Container::value_type>>
+class priority_queue
+{
+public:
+
+    using container_type = Container;
+    using value_compare = Compare;
+    using value_type = typename Container::value_type;
+    using size_type = typename Container::size_type;
+    using reference = typename Container::reference;
+    using const_reference = typename Container::const_reference;
+
+    priority_queue() : priority_queue(Compare())
+    {
+    }
+
+    explicit priority_queue(const Compare& compare) : c{}, comp{compare}
+    {
+    }
+
+    priority_queue(const Compare& compare, const Container& cont)
+        : c(cont), comp{compare}
+    {
+        make_heap(c.begin(), c.end(), comp);
+    }
+
+    priority_queue(const Compare& compare, Container&& cont)
+        : c(move(cont)), comp{compare}
+    {
+        make_heap(c.begin(), c.end(), comp);
+    }
+
+    template<typename InputIt,
+             typename = detail::require_input_iterator<InputIt>>
+    priority_queue(InputIt first, InputIt last,
+                   const Compare& compare = Compare())
+        : c{}, comp{compare}
+    {
+        for (; first != last; ++first)
+            c.push_back(*first);
+
+        make_heap(c.begin(), c.end(), comp);
+    }
+
+    const_reference top() const
+    {
+        return c.front();
+    }
+
+    bool empty() const
+    {
+        return c.empty();
+    }
+
+    size_type size() const
+    {
+        return c.size();
+    }
+
+    void push(const value_type& value)
+    {
+        c.push_back(value);
+        push_heap(c.begin(), c.end(), comp);
+    }
+
+    void push(value_type&& value)
+    {
+        c.push_back(move(value));
+        push_heap(c.begin(), c.end(), comp);
+    }
+
+    template<typename... Args>
+    void emplace(Args&&... args)
+    {
+        c.emplace_back(forward<Args>(args)...);
+        push_heap(c.begin(), c.end(), comp);
+    }
+
+    void pop()
+    {
+        pop_heap(c.begin(), c.end(), comp);
+        c.pop_back();
+    }
+
+    void swap(priority_queue& other)
+    {
+        using STDAVR_NAMESPACE::swap;
+
+        swap(c, other.c);
+        swap(comp, other.comp);
+    }
+
+protected:
+
+    Container c;
+    Compare comp;
+};
+
+template<class T, class Container, class Compare>
+void swap(priority_queue<T, Container, Compare>& lhs,
+          priority_queue<T, Container, Compare>& rhs)
+{
+    lhs.swap(rhs);
+}
+
+}
+
+#endif
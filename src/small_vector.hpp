@@ -0,0 +1,399 @@
+#ifndef STDAVR_SMALL_VECTOR_HPP
+#define STDAVR_SMALL_VECTOR_HPP
+
+#include "namespace.hpp"
+#include "utility.hpp"
+#include "memory.hpp"
+#include "initializer_list.hpp"
+#include "iterator.hpp"
+#include "cstddef.hpp"
+#include "cassert.hpp"
+#include "cstdlib.hpp"
+
+namespace STDAVR_NAMESPACE
+{
+
+// A vector that stores up to N elements inside the object and only allocates
+// heap storage once it grows beyond that.
+template<typename T, size_t N>
+class small_vector
+{
+public:
+
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using iterator = value_type*;
+    using const_iterator = const value_type*;
+
+    small_vector() : data_{inline_data()}, size_{0}, capacity_{N}
+    {
+    }
+
+    small_vector(const small_vector& other) : small_vector()
+    {
+        reserve(other.size());
+        uninitialized_copy(other.begin(), other.end(), data_);
+        size_ = other.size();
+    }
+
+    small_vector(size_type count, const T& value) : small_vector()
+    {
+        reserve(count);
+        uninitialized_fill_n(data_, count, value);
+        size_ = count;
+    }
+
+    explicit small_vector(size_type count) : small_vector()
+    {
+        reserve(count);
+        uninitialized_value_construct_n(data_, count);
+        size_ = count;
+    }
+
+    small_vector(std::initializer_list<T> il)
+        : small_vector(il.begin(), il.end())
+    {
+    }
+
+    small_vector(small_vector&& other)
+        noexcept(is_nothrow_move_constructible_v<T>)
+        : small_vector()
+    {
+        steal(other);
+    }
+
+    template<typename InputIt,
+             typename = detail::require_input_iterator<InputIt>>
+    small_vector(InputIt first, InputIt last) : small_vector()
+    {
+        for (; first != last; ++first)
+            emplace_back(*first);
+    }
+
+    ~small_vector()
+    {
+        release();
+    }
+
+    small_vector& operator=(const small_vector& other)
+    {
+        auto copy = other;
+        swap(copy);
+        return *this;
+    }
+
+    small_vector& operator=(small_vector&& other)
+        noexcept(is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other)
+        {
+            release();
+            data_ = inline_data();
+            size_ = 0;
+            capacity_ = N;
+            steal(other);
+        }
+
+        return *this;
+    }
+
+    small_vector& operator=(std::initializer_list<T> il)
+    {
+        return *this = small_vector(il);
+    }
+
+    size_type size() const noexcept
+    {
+        return size_;
+    }
+
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    size_type capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+    static constexpr size_type max_size() noexcept
+    {
+        return size_t(-1) / sizeof(value_type);
+    }
+
+    static constexpr size_type inline_capacity() noexcept
+    {
+        return N;
+    }
+
+    // Returns whether the elements are currently stored inside the object.
+    bool is_inline() const noexcept
+    {
+        return data_ == inline_data();
+    }
+
+    void reserve(size_type new_capacity)
+    {
+        if (new_capacity > capacity())
+            reallocate(new_capacity);
+    }
+
+    void shrink_to_fit()
+    {
+        if (!is_inline() && capacity() > size())
+            reallocate(size());
+    }
+
+    iterator begin() noexcept
+    {
+        return data_;
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return data_;
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    iterator end() noexcept
+    {
+        return data_ + size_;
+    }
+
+    const_iterator end() const noexcept
+    {
+        return data_ + size_;
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return end();
+    }
+
+    void swap(small_vector& other)
+    {
+        auto tmp = move(*this);
+        *this = move(other);
+        other = move(tmp);
+    }
+
+    reference front()
+    {
+        return const_cast<reference>(
+            const_cast<const small_vector*>(this)->front());
+    }
+
+    const_reference front() const
+    {
+        assert(!empty() && "front() called on empty small_vector");
+
+        return data_[0];
+    }
+
+    reference back()
+    {
+        return const_cast<reference>(
+            const_cast<const small_vector*>(this)->back());
+    }
+
+    const_reference back() const
+    {
+        assert(!empty() && "back() called on empty small_vector");
+
+        return data_[size() - 1];
+    }
+
+    reference operator[](size_type pos)
+    {
+        return const_cast<reference>(
+            const_cast<const small_vector&>(*this)[pos]);
+    }
+
+    const_reference operator[](size_type pos) const
+    {
+        assert(pos < size() && "operator[] index out of range");
+
+        return data_[pos];
+    }
+
+    reference at(size_type pos)
+    {
+        return const_cast<reference>(
+            const_cast<const small_vector*>(this)->at(pos));
+    }
+
+    const_reference at(size_type pos) const
+    {
+        if (pos >= size())
+            abort();
+
+        return (*this)[pos];
+    }
+
+    void push_back(const T& value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value)
+    {
+        emplace_back(move(value));
+    }
+
+    template<typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+        if (size() == capacity())
+        {
+            // The new element is constructed before the existing ones are
+            // relocated since args may refer to one of them.
+            auto new_capacity = grown_capacity();
+            auto new_data = allocate(new_capacity);
+            detail::rollback_guard free_guard{
+                [=] {deallocate(new_data, new_capacity);}};
+            auto element = construct_at(new_data + size_,
+                                        forward<Args>(args)...);
+            detail::rollback_guard destroy_guard{[=] {destroy_at(element);}};
+            adopt(new_data, new_capacity);
+            destroy_guard.release();
+            free_guard.release();
+        }
+        else
+        {
+            construct_at(data_ + size_, forward<Args>(args)...);
+        }
+
+        ++size_;
+        return back();
+    }
+
+    void pop_back()
+    {
+        assert(!empty() && "pop_back() called on empty small_vector");
+
+        destroy_at(data_ + --size_);
+    }
+
+    T* data() noexcept
+    {
+        return data_;
+    }
+
+    const T* data() const noexcept
+    {
+        return data_;
+    }
+
+private:
+
+    T* inline_data() noexcept
+    {
+        return reinterpret_cast<T*>(inline_storage_);
+    }
+
+    const T* inline_data() const noexcept
+    {
+        return reinterpret_cast<const T*>(inline_storage_);
+    }
+
+    size_type grown_capacity() const noexcept
+    {
+        return detail::grown_capacity(capacity_, max_size());
+    }
+
+    static T* allocate(size_type capacity)
+    {
+        if (capacity > max_size())
+            abort();
+
+        return allocator<T>().allocate(capacity);
+    }
+
+    static void deallocate(T* data, size_type capacity)
+    {
+        allocator<T>().deallocate(data, capacity);
+    }
+
+    // Destroys all elements and frees the heap storage, if any.
+    void release()
+    {
+        destroy(begin(), end());
+
+        if (!is_inline())
+            deallocate(data_, capacity_);
+    }
+
+    // Relocates the elements to new_data, which is either the inline storage
+    // or heap storage for new_capacity elements.
+    void adopt(T* new_data, size_type new_capacity)
+    {
+        detail::relocate_if_noexcept(begin(), end(), new_data);
+        auto old_size = size_;
+        size_ = 0;
+        release();
+        data_ = new_data;
+        size_ = old_size;
+        capacity_ = new_capacity;
+    }
+
+    void reallocate(size_type new_capacity)
+    {
+        if (new_capacity <= N)
+        {
+            adopt(inline_data(), N);
+        }
+        else
+        {
+            auto new_data = allocate(new_capacity);
+            detail::rollback_guard guard{
+                [=] {deallocate(new_data, new_capacity);}};
+            adopt(new_data, new_capacity);
+            guard.release();
+        }
+    }
+
+    // Takes over the elements of other, which is left empty. Heap storage is
+    // taken over as a whole while inline elements have to be moved one by one.
+    void steal(small_vector& other)
+    {
+        if (other.is_inline())
+        {
+            uninitialized_move(other.begin(), other.end(), data_);
+            size_ = other.size_;
+            destroy(other.begin(), other.end());
+        }
+        else
+        {
+            data_ = other.data_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inline_data();
+            other.capacity_ = N;
+        }
+
+        other.size_ = 0;
+    }
+
+    value_type* data_;
+    size_type size_;
+    size_type capacity_;
+    alignas(T) unsigned char inline_storage_[(N == 0 ? 1 : N) * sizeof(T)];
+};
+
+template<class T, size_t N>
+void swap(small_vector<T, N>& lhs, small_vector<T, N>& rhs)
+{
+    lhs.swap(rhs);
+}
+
+}
+
+#endif
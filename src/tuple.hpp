@@ -9,24 +9,93 @@
 namespace STDAVR_NAMESPACE
 {
 
+template<typename... Types>
+class tuple;
+
 namespace detail
 {
 
+// The elements are stored in one leaf per element, all of which are direct
+// bases of a single storage class. Unlike a recursive chain of tuples, this
+// needs a constant number of instantiations to construct the tuple or to
+// access any of its elements.
+template<size_t I, typename T>
+struct tuple_leaf
+{
+    T value;
+};
+
+template<typename Indices, typename... Ts>
+struct tuple_storage;
+
+template<size_t... Is, typename... Ts>
+struct tuple_storage<index_sequence<Is...>, Ts...> : tuple_leaf<Is, Ts>...
+{
+    constexpr tuple_storage(const Ts&... values)
+        : tuple_leaf<Is, Ts>{values}...
+    {
+    }
+};
+
+template<typename... Ts>
+using tuple_storage_for = tuple_storage<index_sequence_for<Ts...>, Ts...>;
+
+// Deducing T from the only leaf with index I picks the element without
+// recursing through the preceding ones.
+template<size_t I, typename T>
+constexpr T& leaf_value(tuple_leaf<I, T>& leaf) noexcept
+{
+    return leaf.value;
+}
+
+template<size_t I, typename T>
+constexpr const T& leaf_value(const tuple_leaf<I, T>& leaf) noexcept
+{
+    return leaf.value;
+}
+
+template<size_t I, typename T>
+type_identity<T> leaf_type(const tuple_leaf<I, T>&);
+
+#if defined(__has_builtin)
+#if __has_builtin(__type_pack_element)
+#define STDAVR_HAS_TYPE_PACK_ELEMENT
+#endif
+#endif
+
+#ifdef STDAVR_HAS_TYPE_PACK_ELEMENT
+template<size_t I, typename... Ts>
+using pack_element_t = __type_pack_element<I, Ts...>;
+#else
+template<size_t I, typename... Ts>
+using pack_element_t = typename decltype(
+    leaf_type<I>(declval<const tuple_storage_for<Ts...>&>()))::type;
+#endif
+
+#undef STDAVR_HAS_TYPE_PACK_ELEMENT
+
 template<size_t I, typename Tuple>
-constexpr auto&& get(Tuple&&) noexcept;
+constexpr auto&& get(Tuple&& tup) noexcept
+{
+    using tuple_type = remove_reference_t<Tuple>;
+    static_assert(I < tuple_size_v<tuple_type>, "tuple index out of range");
+
+    auto& value = leaf_value<I>(tup.storage_);
+
+    if constexpr (is_lvalue_reference_v<Tuple>)
+        return value;
+    else
+        return move(value);
+}
 
 } // namespace detail
 
 template<typename... Types>
-class tuple;
-
-template<typename Head, typename... Tail>
-class tuple<Head, Tail...> : public tuple<Tail...>
+class tuple
 {
 public:
 
-    tuple(const Head& value, const Tail&... rest)
-        : tuple<Tail...>{rest...}, value_{value}
+    constexpr tuple(const Types&... values) : storage_{values...}
     {
     }
 
@@ -35,19 +104,16 @@ private:
     template<size_t I, typename Tuple>
     friend constexpr auto&& detail::get(Tuple&&) noexcept;
 
-    Head value_;
+    detail::tuple_storage_for<Types...> storage_;
 };
 
 template<typename... Ts>
 tuple(Ts...) -> tuple<Ts...>;
 
-template<>
-class tuple<> {};
-
 template<typename... Ts>
-auto make_tuple(Ts&&... values)
+constexpr auto make_tuple(Ts&&... values)
 {
-    return tuple<Ts...>{forward<Ts>(values)...};
+    return tuple<decay_t<Ts>...>{forward<Ts>(values)...};
 }
 
 template<typename... Ts>
@@ -59,76 +125,31 @@ struct tuple_size<tuple<Ts...>>
 template<size_t I, typename T>
 struct tuple_element;
 
-template<size_t I, typename T0, typename... Rest>
-struct tuple_element<I, tuple<T0, Rest...>>
+template<size_t I, typename... Ts>
+struct tuple_element<I, tuple<Ts...>>
 {
-    using type = typename tuple_element<I - 1, tuple<Rest...>>::type;
-};
+    static_assert(I < sizeof...(Ts), "tuple index out of range");
 
-template<typename Head, typename... Tail>
-struct tuple_element<0, tuple<Head, Tail...>>
-{
-    using type = Head;
+    using type = detail::pack_element_t<I, Ts...>;
 };
 
 template<size_t I, class T>
 using tuple_element_t = typename tuple_element<I, T>::type;
 
-namespace detail
-{
-
-template<typename T>
-struct tuple_parent;
-
-template<typename Head, typename... Tail>
-struct tuple_parent<tuple<Head, Tail...>>
-{
-    using type = tuple<Tail...>;
-};
-
-template<typename T>
-struct tuple_parent<T&>
-{
-    using type = typename tuple_parent<T>::type&;
-};
-
-template<typename T>
-struct tuple_parent<T&&>
-{
-    using type = typename tuple_parent<T>::type&&;
-};
-
-template<typename T>
-using tuple_parent_t = typename tuple_parent<T>::type;
-
-template<size_t I, typename Tuple>
-constexpr auto&& get(Tuple&& tup) noexcept
-{
-    using tuple_type = remove_reference_t<Tuple>;
-    static_assert(I < tuple_size_v<tuple_type>, "tuple index out of range");
-
-    if constexpr (I == 0)
-        return forward<Tuple>(tup).value_;
-    else
-        return get<I - 1>(forward<tuple_parent_t<Tuple>>(tup));
-}
-
-} // namespace detail
-
-template<size_t I, typename Head, typename... Tail>
-constexpr auto& get(tuple<Head, Tail...>& tup) noexcept
+template<size_t I, typename... Ts>
+constexpr auto& get(tuple<Ts...>& tup) noexcept
 {
     return detail::get<I>(tup);
 }
 
-template<size_t I, typename Head, typename... Tail>
-constexpr auto& get(const tuple<Head, Tail...>& tup) noexcept
+template<size_t I, typename... Ts>
+constexpr auto& get(const tuple<Ts...>& tup) noexcept
 {
     return detail::get<I>(tup);
 }
 
-template<size_t I, typename Head, typename... Tail>
-constexpr auto&& get(tuple<Head, Tail...>&& tup) noexcept
+template<size_t I, typename... Ts>
+constexpr auto&& get(tuple<Ts...>&& tup) noexcept
 {
     return detail::get<I>(move(tup));
 }
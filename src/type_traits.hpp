@@ -2,6 +2,7 @@
 #define STDAVR_TYPE_TRAITS_HPP
 
 #include "namespace.hpp"
+#include "cstddef.hpp"
 
 namespace STDAVR_NAMESPACE
 {
@@ -37,6 +38,11 @@ INTRINSIC_TRAIT(is_empty);
 INTRINSIC_TRAIT(is_standard_layout);
 INTRINSIC_TRAIT(is_trivial);
 INTRINSIC_TRAIT(is_pod);
+INTRINSIC_TRAIT(is_trivially_copyable);
+INTRINSIC_TRAIT(is_final);
+INTRINSIC_TRAIT(is_aggregate);
+INTRINSIC_TRAIT(has_virtual_destructor);
+INTRINSIC_TRAIT(has_unique_object_representations);
 
 #undef INTRINSIC_TRAIT
 
@@ -46,6 +52,263 @@ struct is_base_of : bool_constant<__is_base_of(Base, Derived)> {};
 template<class Base, class Derived>
 inline constexpr bool is_base_of_v = is_base_of<Base, Derived>::value;
 
+template<class T, class U>
+struct is_same : false_type {};
+
+template<class T>
+struct is_same<T, T> : true_type {};
+
+template<class T, class U>
+inline constexpr bool is_same_v = is_same<T, U>::value;
+
+template<class T> struct is_const          : false_type {};
+template<class T> struct is_const<const T> : true_type {};
+
+template<class T>
+inline constexpr bool is_const_v = is_const<T>::value;
+
+template<class T> struct is_volatile             : false_type {};
+template<class T> struct is_volatile<volatile T> : true_type {};
+
+template<class T>
+inline constexpr bool is_volatile_v = is_volatile<T>::value;
+
+template<typename T> struct remove_const          {using type = T;};
+template<typename T> struct remove_const<const T> {using type = T;};
+
+template<class T>
+using remove_const_t = typename remove_const<T>::type;
+
+template<typename T> struct remove_volatile             {using type = T;};
+template<typename T> struct remove_volatile<volatile T> {using type = T;};
+
+template<class T>
+using remove_volatile_t = typename remove_volatile<T>::type;
+
+template<typename T>
+struct remove_cv {using type = remove_const_t<remove_volatile_t<T>>;};
+
+template<class T>
+using remove_cv_t = typename remove_cv<T>::type;
+
+template<typename T> struct add_const    {using type = const T;};
+template<typename T> struct add_volatile {using type = volatile T;};
+template<typename T> struct add_cv       {using type = const volatile T;};
+
+template<class T>
+using add_const_t = typename add_const<T>::type;
+
+template<class T>
+using add_volatile_t = typename add_volatile<T>::type;
+
+template<class T>
+using add_cv_t = typename add_cv<T>::type;
+
+template<class T>
+struct is_void : is_same<remove_cv_t<T>, void> {};
+
+template<class T>
+inline constexpr bool is_void_v = is_void<T>::value;
+
+template<class T>
+struct is_null_pointer : is_same<remove_cv_t<T>, nullptr_t> {};
+
+template<class T>
+inline constexpr bool is_null_pointer_v = is_null_pointer<T>::value;
+
+template<class T>           struct is_array       : false_type {};
+template<class T>           struct is_array<T[]>  : true_type {};
+template<class T, size_t N> struct is_array<T[N]> : true_type {};
+
+template<class T>
+inline constexpr bool is_array_v = is_array<T>::value;
+
+template<class T>           struct is_bounded_array       : false_type {};
+template<class T, size_t N> struct is_bounded_array<T[N]> : true_type {};
+
+template<class T>
+inline constexpr bool is_bounded_array_v = is_bounded_array<T>::value;
+
+template<class T>           struct is_unbounded_array      : false_type {};
+template<class T>           struct is_unbounded_array<T[]> : true_type {};
+
+template<class T>
+inline constexpr bool is_unbounded_array_v = is_unbounded_array<T>::value;
+
+template<class T>           struct remove_extent       {using type = T;};
+template<class T>           struct remove_extent<T[]>  {using type = T;};
+template<class T, size_t N> struct remove_extent<T[N]> {using type = T;};
+
+template<class T>
+using remove_extent_t = typename remove_extent<T>::type;
+
+template<class T>
+struct remove_all_extents {using type = T;};
+
+template<class T>
+struct remove_all_extents<T[]> : remove_all_extents<T> {};
+
+template<class T, size_t N>
+struct remove_all_extents<T[N]> : remove_all_extents<T> {};
+
+template<class T>
+using remove_all_extents_t = typename remove_all_extents<T>::type;
+
+namespace detail
+{
+
+template<typename T> struct is_pointer_impl     : false_type {};
+template<typename T> struct is_pointer_impl<T*> : true_type {};
+
+} // namespace detail
+
+template<class T>
+struct is_pointer : detail::is_pointer_impl<remove_cv_t<T>> {};
+
+template<class T>
+inline constexpr bool is_pointer_v = is_pointer<T>::value;
+
+template<typename T> struct remove_pointer     {using type = T;};
+template<typename T> struct remove_pointer<T*> {using type = T;};
+
+template<typename T>
+struct remove_pointer<T* const> {using type = T;};
+
+template<typename T>
+struct remove_pointer<T* volatile> {using type = T;};
+
+template<typename T>
+struct remove_pointer<T* const volatile> {using type = T;};
+
+template<class T>
+using remove_pointer_t = typename remove_pointer<T>::type;
+
+namespace detail
+{
+
+template<typename T> struct is_integral_impl           : false_type {};
+template<> struct is_integral_impl<bool>               : true_type {};
+template<> struct is_integral_impl<char>               : true_type {};
+template<> struct is_integral_impl<signed char>        : true_type {};
+template<> struct is_integral_impl<unsigned char>      : true_type {};
+template<> struct is_integral_impl<wchar_t>            : true_type {};
+template<> struct is_integral_impl<char16_t>           : true_type {};
+template<> struct is_integral_impl<char32_t>           : true_type {};
+template<> struct is_integral_impl<short>              : true_type {};
+template<> struct is_integral_impl<unsigned short>     : true_type {};
+template<> struct is_integral_impl<int>                : true_type {};
+template<> struct is_integral_impl<unsigned int>       : true_type {};
+template<> struct is_integral_impl<long>               : true_type {};
+template<> struct is_integral_impl<unsigned long>      : true_type {};
+template<> struct is_integral_impl<long long>          : true_type {};
+template<> struct is_integral_impl<unsigned long long> : true_type {};
+
+template<typename T> struct is_floating_point_impl    : false_type {};
+template<> struct is_floating_point_impl<float>       : true_type {};
+template<> struct is_floating_point_impl<double>      : true_type {};
+template<> struct is_floating_point_impl<long double> : true_type {};
+
+} // namespace detail
+
+template<class T>
+struct is_integral : detail::is_integral_impl<remove_cv_t<T>> {};
+
+template<class T>
+inline constexpr bool is_integral_v = is_integral<T>::value;
+
+template<class T>
+struct is_floating_point : detail::is_floating_point_impl<remove_cv_t<T>> {};
+
+template<class T>
+inline constexpr bool is_floating_point_v = is_floating_point<T>::value;
+
+template<class T>
+struct is_arithmetic : bool_constant<is_integral_v<T> || is_floating_point_v<T>>
+{
+};
+
+template<class T>
+inline constexpr bool is_arithmetic_v = is_arithmetic<T>::value;
+
+template<class T>
+struct is_fundamental
+    : bool_constant<is_arithmetic_v<T> || is_void_v<T> || is_null_pointer_v<T>>
+{
+};
+
+template<class T>
+inline constexpr bool is_fundamental_v = is_fundamental<T>::value;
+
+template<class T>
+struct is_compound : bool_constant<!is_fundamental_v<T>> {};
+
+template<class T>
+inline constexpr bool is_compound_v = is_compound<T>::value;
+
+namespace detail
+{
+
+template<typename T, bool = is_arithmetic_v<T>>
+struct is_signed_impl : bool_constant<T(-1) < T(0)> {};
+
+template<typename T>
+struct is_signed_impl<T, false> : false_type {};
+
+} // namespace detail
+
+template<class T>
+struct is_signed : detail::is_signed_impl<T> {};
+
+template<class T>
+inline constexpr bool is_signed_v = is_signed<T>::value;
+
+template<class T>
+struct is_unsigned : bool_constant<is_integral_v<T> && !is_signed_v<T>> {};
+
+template<class T>
+inline constexpr bool is_unsigned_v = is_unsigned<T>::value;
+
+template<typename T> struct make_unsigned;
+template<> struct make_unsigned<char>        {using type = unsigned char;};
+template<> struct make_unsigned<signed char> {using type = unsigned char;};
+template<> struct make_unsigned<short>       {using type = unsigned short;};
+template<> struct make_unsigned<int>         {using type = unsigned int;};
+template<> struct make_unsigned<long>        {using type = unsigned long;};
+template<> struct make_unsigned<long long>   {using type = unsigned long long;};
+
+template<> struct make_unsigned<unsigned char>  {using type = unsigned char;};
+template<> struct make_unsigned<unsigned short> {using type = unsigned short;};
+template<> struct make_unsigned<unsigned int>   {using type = unsigned int;};
+template<> struct make_unsigned<unsigned long>  {using type = unsigned long;};
+
+template<>
+struct make_unsigned<unsigned long long> {using type = unsigned long long;};
+
+template<class T>
+using make_unsigned_t = typename make_unsigned<T>::type;
+
+template<typename T> struct make_signed;
+template<> struct make_signed<char>               {using type = signed char;};
+template<> struct make_signed<signed char>        {using type = signed char;};
+template<> struct make_signed<unsigned char>      {using type = signed char;};
+template<> struct make_signed<short>              {using type = short;};
+template<> struct make_signed<unsigned short>     {using type = short;};
+template<> struct make_signed<int>                {using type = int;};
+template<> struct make_signed<unsigned int>       {using type = int;};
+template<> struct make_signed<long>               {using type = long;};
+template<> struct make_signed<unsigned long>      {using type = long;};
+template<> struct make_signed<long long>          {using type = long long;};
+template<> struct make_signed<unsigned long long> {using type = long long;};
+
+template<class T>
+using make_signed_t = typename make_signed<T>::type;
+
+template<class T>
+struct underlying_type {using type = __underlying_type(T);};
+
+template<class T>
+using underlying_type_t = typename underlying_type<T>::type;
+
 template<typename T> struct remove_reference      {using type = T;};
 template<typename T> struct remove_reference<T&>  {using type = T;};
 template<typename T> struct remove_reference<T&&> {using type = T;};
@@ -56,6 +319,490 @@ using remove_reference_t = typename remove_reference<T>::type;
 template<typename...>
 using void_t = void;
 
+template<class T>
+struct remove_cvref {using type = remove_cv_t<remove_reference_t<T>>;};
+
+template<class T>
+using remove_cvref_t = typename remove_cvref<T>::type;
+
+template<class T>
+struct type_identity {using type = T;};
+
+template<class T>
+using type_identity_t = typename type_identity<T>::type;
+
+template<class T> struct is_lvalue_reference     : false_type {};
+template<class T> struct is_lvalue_reference<T&> : true_type {};
+
+template<class T>
+inline constexpr bool is_lvalue_reference_v = is_lvalue_reference<T>::value;
+
+template<class T> struct is_rvalue_reference      : false_type {};
+template<class T> struct is_rvalue_reference<T&&> : true_type {};
+
+template<class T>
+inline constexpr bool is_rvalue_reference_v = is_rvalue_reference<T>::value;
+
+template<class T>
+struct is_reference
+    : bool_constant<is_lvalue_reference_v<T> || is_rvalue_reference_v<T>> {};
+
+template<class T>
+inline constexpr bool is_reference_v = is_reference<T>::value;
+
+// Only functions and references cannot be const-qualified.
+template<class T>
+struct is_function
+    : bool_constant<!is_const_v<const T> && !is_reference_v<T>> {};
+
+template<class T>
+inline constexpr bool is_function_v = is_function<T>::value;
+
+template<class T>
+struct is_object
+    : bool_constant<!is_function_v<T> && !is_reference_v<T> && !is_void_v<T>>
+{
+};
+
+template<class T>
+inline constexpr bool is_object_v = is_object<T>::value;
+
+namespace detail
+{
+
+template<typename T>
+struct is_member_pointer_impl : false_type {};
+
+template<typename T, typename C>
+struct is_member_pointer_impl<T C::*> : true_type {};
+
+template<typename T>
+struct is_member_function_pointer_impl : false_type {};
+
+template<typename T, typename C>
+struct is_member_function_pointer_impl<T C::*> : is_function<T> {};
+
+} // namespace detail
+
+template<class T>
+struct is_member_pointer : detail::is_member_pointer_impl<remove_cv_t<T>> {};
+
+template<class T>
+inline constexpr bool is_member_pointer_v = is_member_pointer<T>::value;
+
+template<class T>
+struct is_member_function_pointer
+    : detail::is_member_function_pointer_impl<remove_cv_t<T>> {};
+
+template<class T>
+inline constexpr bool is_member_function_pointer_v =
+    is_member_function_pointer<T>::value;
+
+template<class T>
+struct is_member_object_pointer
+    : bool_constant<is_member_pointer_v<T> &&
+                    !is_member_function_pointer_v<T>> {};
+
+template<class T>
+inline constexpr bool is_member_object_pointer_v =
+    is_member_object_pointer<T>::value;
+
+template<class T>
+struct is_scalar
+    : bool_constant<is_arithmetic_v<T> || is_enum_v<T> || is_pointer_v<T> ||
+                    is_member_pointer_v<T> || is_null_pointer_v<T>> {};
+
+template<class T>
+inline constexpr bool is_scalar_v = is_scalar<T>::value;
+
+namespace detail
+{
+
+// References to void and to cv- or ref-qualified function types cannot be
+// formed, in which case the type stays as it is.
+template<typename T, typename = void>
+struct add_reference_impl
+{
+    using lvalue = T;
+    using rvalue = T;
+};
+
+template<typename T>
+struct add_reference_impl<T, void_t<T&>>
+{
+    using lvalue = T&;
+    using rvalue = T&&;
+};
+
+template<typename T, typename = void>
+struct add_pointer_impl {using type = T;};
+
+template<typename T>
+struct add_pointer_impl<T, void_t<remove_reference_t<T>*>>
+{
+    using type = remove_reference_t<T>*;
+};
+
+} // namespace detail
+
+template<class T>
+struct add_lvalue_reference
+{
+    using type = typename detail::add_reference_impl<T>::lvalue;
+};
+
+template<class T>
+using add_lvalue_reference_t = typename add_lvalue_reference<T>::type;
+
+template<class T>
+struct add_rvalue_reference
+{
+    using type = typename detail::add_reference_impl<T>::rvalue;
+};
+
+template<class T>
+using add_rvalue_reference_t = typename add_rvalue_reference<T>::type;
+
+template<class T>
+struct add_pointer : detail::add_pointer_impl<T> {};
+
+template<class T>
+using add_pointer_t = typename add_pointer<T>::type;
+
+// Only for use in unevaluated operands such as decltype and noexcept.
+template<class T>
+add_rvalue_reference_t<T> declval() noexcept;
+
+template<bool B, typename T, typename F>
+struct conditional {using type = T;};
+
+template<typename T, typename F>
+struct conditional<false, T, F> {using type = F;};
+
+template<bool B, typename T, typename F>
+using conditional_t = typename conditional<B, T, F>::type;
+
+// The type a T argument has when passed by value: arrays and functions turn
+// into pointers and references and cv-qualifiers are removed.
+template<class T>
+struct decay
+{
+private:
+
+    using U = remove_reference_t<T>;
+
+public:
+
+    using type = conditional_t<
+        is_array_v<U>,
+        remove_extent_t<U>*,
+        conditional_t<is_function_v<U>, add_pointer_t<U>, remove_cv_t<U>>>;
+};
+
+template<class T>
+using decay_t = typename decay<T>::type;
+
+template<class...>
+struct conjunction : true_type {};
+
+template<class B>
+struct conjunction<B> : B {};
+
+template<class B, class... Bs>
+struct conjunction<B, Bs...>
+    : conditional_t<bool(B::value), conjunction<Bs...>, B> {};
+
+template<class... Bs>
+inline constexpr bool conjunction_v = conjunction<Bs...>::value;
+
+template<class...>
+struct disjunction : false_type {};
+
+template<class B>
+struct disjunction<B> : B {};
+
+template<class B, class... Bs>
+struct disjunction<B, Bs...>
+    : conditional_t<bool(B::value), B, disjunction<Bs...>> {};
+
+template<class... Bs>
+inline constexpr bool disjunction_v = disjunction<Bs...>::value;
+
+template<class B>
+struct negation : bool_constant<!bool(B::value)> {};
+
+template<class B>
+inline constexpr bool negation_v = negation<B>::value;
+
+template<typename T, typename... Args>
+struct is_constructible : bool_constant<__is_constructible(T, Args...)> {};
+
+template<typename T, typename... Args>
+inline constexpr bool is_constructible_v = is_constructible<T, Args...>::value;
+
+template<typename T, typename... Args>
+struct is_nothrow_constructible
+    : bool_constant<__is_nothrow_constructible(T, Args...)> {};
+
+template<typename T, typename... Args>
+inline constexpr bool is_nothrow_constructible_v =
+    is_nothrow_constructible<T, Args...>::value;
+
+template<typename T, typename... Args>
+struct is_trivially_constructible
+    : bool_constant<__is_trivially_constructible(T, Args...)> {};
+
+template<typename T, typename... Args>
+inline constexpr bool is_trivially_constructible_v =
+    is_trivially_constructible<T, Args...>::value;
+
+template<typename T>
+struct is_trivially_default_constructible : is_trivially_constructible<T> {};
+
+template<typename T>
+inline constexpr bool is_trivially_default_constructible_v =
+    is_trivially_default_constructible<T>::value;
+
+// Whether an object of type T can be moved to another address by copying its
+// bytes, without running any constructor or the destructor of the original.
+// Class types that are not trivially copyable but still satisfy this (e.g.,
+// because they only own memory through a pointer) may specialize this trait.
+template<typename T>
+struct is_trivially_relocatable : is_trivially_copyable<T> {};
+
+template<typename T>
+inline constexpr bool is_trivially_relocatable_v =
+    is_trivially_relocatable<T>::value;
+
+template<typename T>
+struct is_copy_constructible : is_constructible<T, const T&> {};
+
+template<typename T>
+inline constexpr bool is_copy_constructible_v = is_copy_constructible<T>::value;
+
+template<typename T>
+struct is_move_constructible : is_constructible<T, T&&> {};
+
+template<typename T>
+inline constexpr bool is_move_constructible_v = is_move_constructible<T>::value;
+
+template<typename T>
+struct is_nothrow_move_constructible : is_nothrow_constructible<T, T&&> {};
+
+template<typename T>
+inline constexpr bool is_nothrow_move_constructible_v =
+    is_nothrow_move_constructible<T>::value;
+
+template<typename T>
+struct is_default_constructible : is_constructible<T> {};
+
+template<typename T>
+inline constexpr bool is_default_constructible_v =
+    is_default_constructible<T>::value;
+
+template<typename T>
+struct is_nothrow_default_constructible : is_nothrow_constructible<T> {};
+
+template<typename T>
+inline constexpr bool is_nothrow_default_constructible_v =
+    is_nothrow_default_constructible<T>::value;
+
+template<typename T>
+struct is_nothrow_copy_constructible
+    : is_nothrow_constructible<T, add_lvalue_reference_t<const T>> {};
+
+template<typename T>
+inline constexpr bool is_nothrow_copy_constructible_v =
+    is_nothrow_copy_constructible<T>::value;
+
+template<typename T>
+struct is_trivially_copy_constructible
+    : is_trivially_constructible<T, add_lvalue_reference_t<const T>> {};
+
+template<typename T>
+inline constexpr bool is_trivially_copy_constructible_v =
+    is_trivially_copy_constructible<T>::value;
+
+template<typename T>
+struct is_trivially_move_constructible
+    : is_trivially_constructible<T, add_rvalue_reference_t<T>> {};
+
+template<typename T>
+inline constexpr bool is_trivially_move_constructible_v =
+    is_trivially_move_constructible<T>::value;
+
+template<typename T, typename U>
+struct is_assignable : bool_constant<__is_assignable(T, U)> {};
+
+template<typename T, typename U>
+inline constexpr bool is_assignable_v = is_assignable<T, U>::value;
+
+template<typename T>
+struct is_copy_assignable
+    : is_assignable<add_lvalue_reference_t<T>,
+                    add_lvalue_reference_t<const T>> {};
+
+template<typename T>
+inline constexpr bool is_copy_assignable_v = is_copy_assignable<T>::value;
+
+template<typename T>
+struct is_move_assignable
+    : is_assignable<add_lvalue_reference_t<T>, add_rvalue_reference_t<T>> {};
+
+template<typename T>
+inline constexpr bool is_move_assignable_v = is_move_assignable<T>::value;
+
+template<typename T, typename U>
+struct is_nothrow_assignable
+    : bool_constant<__is_nothrow_assignable(T, U)> {};
+
+template<typename T, typename U>
+inline constexpr bool is_nothrow_assignable_v =
+    is_nothrow_assignable<T, U>::value;
+
+template<typename T>
+struct is_nothrow_copy_assignable
+    : is_nothrow_assignable<add_lvalue_reference_t<T>,
+                            add_lvalue_reference_t<const T>> {};
+
+template<typename T>
+inline constexpr bool is_nothrow_copy_assignable_v =
+    is_nothrow_copy_assignable<T>::value;
+
+template<typename T>
+struct is_nothrow_move_assignable
+    : is_nothrow_assignable<add_lvalue_reference_t<T>,
+                            add_rvalue_reference_t<T>> {};
+
+template<typename T>
+inline constexpr bool is_nothrow_move_assignable_v =
+    is_nothrow_move_assignable<T>::value;
+
+template<typename T, typename U>
+struct is_trivially_assignable
+    : bool_constant<__is_trivially_assignable(T, U)> {};
+
+template<typename T, typename U>
+inline constexpr bool is_trivially_assignable_v =
+    is_trivially_assignable<T, U>::value;
+
+template<typename T>
+struct is_trivially_copy_assignable
+    : is_trivially_assignable<add_lvalue_reference_t<T>,
+                              add_lvalue_reference_t<const T>> {};
+
+template<typename T>
+inline constexpr bool is_trivially_copy_assignable_v =
+    is_trivially_copy_assignable<T>::value;
+
+template<typename T>
+struct is_trivially_move_assignable
+    : is_trivially_assignable<add_lvalue_reference_t<T>,
+                              add_rvalue_reference_t<T>> {};
+
+template<typename T>
+inline constexpr bool is_trivially_move_assignable_v =
+    is_trivially_move_assignable<T>::value;
+
+namespace detail
+{
+
+template<typename T, typename = void>
+struct destructor_traits
+{
+    static constexpr bool destructible = false;
+    static constexpr bool nothrow = false;
+};
+
+template<typename T>
+struct destructor_traits<T, void_t<decltype(declval<T&>().~T())>>
+{
+    static constexpr bool destructible = true;
+    static constexpr bool nothrow = noexcept(declval<T&>().~T());
+};
+
+// References are always destructible while void, functions and arrays of
+// unknown bound never are. Everything else has to have an accessible
+// destructor.
+template<typename T>
+struct destructor_query
+    : destructor_traits<conditional_t<is_unbounded_array_v<T>, void,
+                                      remove_all_extents_t<T>>> {};
+
+template<typename T>
+struct destructor_query<T&>
+{
+    static constexpr bool destructible = true;
+    static constexpr bool nothrow = true;
+};
+
+template<typename T>
+struct destructor_query<T&&> : destructor_query<T&> {};
+
+} // namespace detail
+
+template<typename T>
+struct is_destructible
+    : bool_constant<detail::destructor_query<T>::destructible> {};
+
+template<typename T>
+inline constexpr bool is_destructible_v = is_destructible<T>::value;
+
+template<typename T>
+struct is_nothrow_destructible
+    : bool_constant<detail::destructor_query<T>::nothrow> {};
+
+template<typename T>
+inline constexpr bool is_nothrow_destructible_v =
+    is_nothrow_destructible<T>::value;
+
+// The builtin also reports deleted and inaccessible destructors, as well as
+// arrays of unknown bound, as trivial.
+template<typename T>
+struct is_trivially_destructible
+    : bool_constant<is_destructible_v<T> && __has_trivial_destructor(T)> {};
+
+template<typename T>
+inline constexpr bool is_trivially_destructible_v =
+    is_trivially_destructible<T>::value;
+
+namespace detail
+{
+
+// GCC only has a builtin for this since version 13.
+template<typename From, typename To,
+         bool = is_void_v<From> || is_function_v<To> || is_array_v<To>>
+struct is_convertible_impl : bool_constant<is_void_v<To>> {};
+
+template<typename From, typename To>
+struct is_convertible_impl<From, To, false>
+{
+private:
+
+    template<typename T>
+    static void accept(T) noexcept;
+
+    template<typename F, typename T,
+             typename = decltype(accept<T>(declval<F>()))>
+    static true_type test(int);
+
+    template<typename, typename>
+    static false_type test(...);
+
+public:
+
+    static constexpr bool value = decltype(test<From, To>(0))::value;
+};
+
+} // namespace detail
+
+template<typename From, typename To>
+struct is_convertible
+    : bool_constant<detail::is_convertible_impl<From, To>::value> {};
+
+template<typename From, typename To>
+inline constexpr bool is_convertible_v = is_convertible<From, To>::value;
+
 template<bool B, typename T = void>
 struct enable_if {};
 
@@ -65,6 +812,75 @@ struct enable_if<true, T> {using type = T;};
 template<bool B, typename T = void>
 using enable_if_t = typename enable_if<B, T>::type;
 
+// Declared here, defined in utility, so that the swappable traits below see
+// the same swap() that generic code would fall back to.
+template<class T>
+enable_if_t<is_move_constructible_v<T> && is_move_assignable_v<T>>
+swap(T& a, T& b) noexcept(is_nothrow_move_constructible_v<T> &&
+                          is_nothrow_move_assignable_v<T>);
+
+namespace detail
+{
+
+namespace swappable
+{
+
+using STDAVR_NAMESPACE::swap;
+
+template<typename T, typename U, typename = void>
+struct swap_traits
+{
+    static constexpr bool swappable = false;
+    static constexpr bool nothrow = false;
+};
+
+template<typename T, typename U>
+struct swap_traits<T, U,
+                   void_t<decltype(swap(declval<T>(), declval<U>())),
+                          decltype(swap(declval<U>(), declval<T>()))>>
+{
+    static constexpr bool swappable = true;
+    static constexpr bool nothrow =
+        noexcept(swap(declval<T>(), declval<U>())) &&
+        noexcept(swap(declval<U>(), declval<T>()));
+};
+
+} // namespace swappable
+
+} // namespace detail
+
+template<class T, class U>
+struct is_swappable_with
+    : bool_constant<detail::swappable::swap_traits<T, U>::swappable> {};
+
+template<class T, class U>
+inline constexpr bool is_swappable_with_v = is_swappable_with<T, U>::value;
+
+template<class T>
+struct is_swappable
+    : is_swappable_with<add_lvalue_reference_t<T>, add_lvalue_reference_t<T>>
+{
+};
+
+template<class T>
+inline constexpr bool is_swappable_v = is_swappable<T>::value;
+
+template<class T, class U>
+struct is_nothrow_swappable_with
+    : bool_constant<detail::swappable::swap_traits<T, U>::nothrow> {};
+
+template<class T, class U>
+inline constexpr bool is_nothrow_swappable_with_v =
+    is_nothrow_swappable_with<T, U>::value;
+
+template<class T>
+struct is_nothrow_swappable
+    : is_nothrow_swappable_with<add_lvalue_reference_t<T>,
+                                add_lvalue_reference_t<T>> {};
+
+template<class T>
+inline constexpr bool is_nothrow_swappable_v = is_nothrow_swappable<T>::value;
+
 }
 
 #endif
@@ -3,6 +3,7 @@
 
 #include "namespace.hpp"
 #include "type_traits.hpp"
+#include "cstddef.hpp"
 
 namespace STDAVR_NAMESPACE
 {
@@ -25,6 +26,45 @@ constexpr remove_reference_t<T>&& move(T&& t) noexcept
     return static_cast<remove_reference_t<T>&&>(t);
 }
 
+template<class T>
+constexpr conditional_t<!is_nothrow_move_constructible_v<T> &&
+                            is_copy_constructible_v<T>,
+                        const T&, T&&>
+move_if_noexcept(T& t) noexcept
+{
+    return move(t);
+}
+
+template<class T, T... Ints>
+struct integer_sequence
+{
+    using value_type = T;
+
+    static constexpr size_t size() noexcept
+    {
+        return sizeof...(Ints);
+    }
+};
+
+template<size_t... Ints>
+using index_sequence = integer_sequence<size_t, Ints...>;
+
+// Both builtins produce the sequence in a single step instead of the
+// logarithmic number of instantiations a library implementation needs.
+#ifdef __clang__
+template<class T, T N>
+using make_integer_sequence = __make_integer_seq<integer_sequence, T, N>;
+#else
+template<class T, T N>
+using make_integer_sequence = integer_sequence<T, __integer_pack(N)...>;
+#endif
+
+template<size_t N>
+using make_index_sequence = make_integer_sequence<size_t, N>;
+
+template<class... T>
+using index_sequence_for = make_index_sequence<sizeof...(T)>;
+
 template<typename T>
 struct tuple_size;
 
@@ -40,10 +80,50 @@ struct tuple_size<const volatile T> : tuple_size<T> {};
 template<class T>
 inline constexpr size_t tuple_size_v = tuple_size<T>::value;
 
-// TODO Disable when T is not move constructible/assignable.
-// TODO Add noexcept
+template<class T1, class T2>
+struct pair
+{
+    using first_type = T1;
+    using second_type = T2;
+
+    constexpr pair() : first{}, second{}
+    {
+    }
+
+    constexpr pair(const T1& first, const T2& second)
+        : first{first}, second{second}
+    {
+    }
+
+    T1 first;
+    T2 second;
+};
+
+template<class T1, class T2>
+pair(T1, T2) -> pair<T1, T2>;
+
+template<class T1, class T2>
+constexpr pair<T1, T2> make_pair(T1 first, T2 second)
+{
+    return pair<T1, T2>{first, second};
+}
+
+template<class T1, class T2>
+constexpr bool operator==(const pair<T1, T2>& lhs, const pair<T1, T2>& rhs)
+{
+    return lhs.first == rhs.first && lhs.second == rhs.second;
+}
+
+template<class T1, class T2>
+constexpr bool operator!=(const pair<T1, T2>& lhs, const pair<T1, T2>& rhs)
+{
+    return !(lhs == rhs);
+}
+
 template<class T>
-void swap(T& a, T& b)
+enable_if_t<is_move_constructible_v<T> && is_move_assignable_v<T>>
+swap(T& a, T& b) noexcept(is_nothrow_move_constructible_v<T> &&
+                          is_nothrow_move_assignable_v<T>)
 {
     auto tmp_a = move(a);
     a = move(b);
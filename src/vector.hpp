@@ -3,8 +3,13 @@
 
 #include "namespace.hpp"
 #include "utility.hpp"
+#include "memory.hpp"
+#include "algorithm.hpp"
+#include "bit.hpp"
+#include "cstring.hpp"
 #include "initializer_list.hpp"
 #include "iterator.hpp"
+#include "type_traits.hpp"
 #include "cstddef.hpp"
 #include "cassert.hpp"
 #include "cstdlib.hpp"
@@ -12,73 +17,114 @@
 namespace STDAVR_NAMESPACE
 {
 
-template<typename T>
+// Allocator must provide allocate(n) and deallocate(p, n) member functions for
+// storage of n elements of type T, like allocator<T> does.
+//
+// SizeType is the unsigned type used to store the size and capacity. Using a
+// narrower type than size_t makes the vector itself smaller at the cost of
+// limiting max_size(). Growing beyond max_size() aborts.
+template<typename T, typename Allocator = allocator<T>,
+         typename SizeType = size_t>
 class vector
 {
 public:
 
     using value_type = T;
-    using size_type = size_t;
+    using allocator_type = Allocator;
+    using size_type = SizeType;
     using difference_type = ptrdiff_t;
     using reference = value_type&;
     using const_reference = const value_type&;
     using iterator = value_type*;
     using const_iterator = const value_type*;
+    using reverse_iterator = STDAVR_NAMESPACE::reverse_iterator<iterator>;
+    using const_reverse_iterator =
+        STDAVR_NAMESPACE::reverse_iterator<const_iterator>;
 
-    vector() : data_{nullptr}, size_{0}, capacity_{0}
+    vector() : vector(Allocator())
     {
     }
 
-    vector(const vector& other) : vector(allocate_tag{}, other.size())
+    explicit vector(const Allocator& alloc) noexcept
+        : storage_{alloc}, size_{0}, capacity_{0}
     {
-        auto other_it = other.begin();
+    }
+
+    vector(const vector& other) : vector(other, other.get_allocator())
+    {
+    }
 
-        for (auto& element : *this)
-            new (&element) T(*other_it++);
+    vector(const vector& other, const Allocator& alloc)
+        : vector(allocate_tag{}, other.size(), alloc)
+    {
+        uninitialized_copy(other.begin(), other.end(), storage_.data);
+        size_ = other.size();
     }
 
-    vector(size_type count, const T& value) : vector(allocate_tag{}, count)
+    vector(size_type count, const T& value,
+           const Allocator& alloc = Allocator())
+        : vector(allocate_tag{}, count, alloc)
     {
-        for (auto& element : *this)
-            new (&element) T(value);
+        uninitialized_fill_n(storage_.data, count, value);
+        size_ = count;
     }
 
-    explicit vector(size_type count) : vector{allocate_tag{}, count}
+    explicit vector(size_type count, const Allocator& alloc = Allocator())
+        : vector{allocate_tag{}, count, alloc}
     {
-        for (auto& element : *this)
-            new (&element) T();
+        uninitialized_value_construct_n(storage_.data, count);
+        size_ = count;
     }
 
-    vector(std::initializer_list<T> il) : vector(il.begin(), il.end())
+    vector(std::initializer_list<T> il, const Allocator& alloc = Allocator())
+        : vector(il.begin(), il.end(), alloc)
     {
     }
 
     vector(vector&& other) noexcept
-        : data_{other.data_}, size_{other.size_}, capacity_{other.capacity_}
+        : storage_{move(other.storage_)},
+          size_{other.size_}, capacity_{other.capacity_}
     {
-        other.data_ = nullptr;
+        other.storage_.data = nullptr;
         other.size_ = 0;
         other.capacity_ = 0;
     }
 
+    // Forward ranges are measured first so that a single allocation suffices.
+    // Single-pass input ranges have to be appended element by element.
     template<typename InputIt,
              typename = detail::require_input_iterator<InputIt>>
-    vector(InputIt first, InputIt last) : vector(allocate_tag{}, last - first)
+    vector(InputIt first, InputIt last, const Allocator& alloc = Allocator())
+        : vector(alloc)
     {
-        auto it = first;
-
-        for (auto& element : *this)
-            new (&element) T(*it++);
+        append(first, last);
     }
 
     ~vector()
     {
-        delete[] data_;
+        destroy(begin(), end());
+
+        if (storage_.data != nullptr)
+            storage_.deallocate(storage_.data, capacity_);
     }
 
     vector& operator=(const vector& other)
     {
-        auto copy = other;
+        // Trivially copyable elements can simply be overwritten so there is no
+        // need to reallocate if they fit in the existing storage.
+        if constexpr (is_trivially_copyable_v<T>)
+        {
+            if (other.size() <= capacity())
+            {
+                if (this != &other)
+                    uninitialized_copy(other.begin(), other.end(), data());
+
+                size_ = other.size();
+                return *this;
+            }
+        }
+
+        auto copy = vector(other, get_allocator());
         swap(copy);
         return *this;
     }
@@ -92,11 +138,81 @@ public:
 
     vector& operator=(std::initializer_list<T> il)
     {
-        auto vec = vector(il);
-        swap(vec);
+        assign(il);
         return *this;
     }
 
+    // The assign() overloads reuse the existing storage when the new elements
+    // fit in it.
+    void assign(size_type count, const T& value)
+    {
+        if (count > capacity())
+        {
+            auto vec = vector(count, value, get_allocator());
+            swap(vec);
+            return;
+        }
+
+        auto overlap = count < size() ? count : size();
+
+        fill_n(begin(), overlap, value);
+
+        if (count > size())
+        {
+            uninitialized_fill_n(end(), count - size(), value);
+            size_ = count;
+        }
+        else
+        {
+            truncate(count);
+        }
+    }
+
+    template<typename InputIt,
+             typename = detail::require_input_iterator<InputIt>>
+    void assign(InputIt first, InputIt last)
+    {
+        if constexpr (detail::is_forward_iterator_v<InputIt>)
+        {
+            auto count = size_t(distance(first, last));
+
+            if (count > capacity())
+            {
+                auto vec = vector(first, last, get_allocator());
+                swap(vec);
+                return;
+            }
+
+            // Trivially copyable elements can simply be overwritten.
+            if constexpr (detail::is_bitwise_copyable_v<InputIt, iterator>)
+            {
+                uninitialized_copy(first, last, begin());
+                size_ = count;
+                return;
+            }
+        }
+
+        auto out = begin();
+
+        for (; first != last && out != end(); ++first, ++out)
+            *out = *first;
+
+        if (first == last)
+            truncate(out - begin());
+        else
+            append(first, last);
+    }
+
+    void assign(std::initializer_list<T> il)
+    {
+        assign(il.begin(), il.end());
+    }
+
+    allocator_type get_allocator() const noexcept
+    {
+        return storage_;
+    }
+
     size_type size() const noexcept
     {
         return size_;
@@ -112,6 +228,26 @@ public:
         return capacity_;
     }
 
+    static constexpr size_type max_size() noexcept
+    {
+        constexpr auto max_size_type = size_type(-1);
+        constexpr auto max_elements = size_t(-1) / sizeof(value_type);
+
+        return max_size_type < max_elements ? max_size_type : max_elements;
+    }
+
+    void reserve(size_type new_capacity)
+    {
+        if (new_capacity > capacity())
+            reallocate(new_capacity);
+    }
+
+    void shrink_to_fit()
+    {
+        if (capacity() > size())
+            reallocate(size());
+    }
+
     iterator begin() noexcept
     {
         return const_cast<iterator>(const_cast<const vector*>(this)->begin());
@@ -119,7 +255,7 @@ public:
 
     const_iterator begin() const noexcept
     {
-        return data_;
+        return storage_.data;
     }
 
     const_iterator cbegin() const noexcept
@@ -134,7 +270,7 @@ public:
 
     const_iterator end() const noexcept
     {
-        return data_ + size_;
+        return storage_.data + size_;
     }
 
     const_iterator cend() const noexcept
@@ -142,11 +278,41 @@ public:
         return end();
     }
 
+    reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator crbegin() const noexcept
+    {
+        return rbegin();
+    }
+
+    reverse_iterator rend() noexcept
+    {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    const_reverse_iterator crend() const noexcept
+    {
+        return rend();
+    }
+
     // TODO Add noexcept
     void swap(vector& other)
     {
         using STDAVR_NAMESPACE::swap;
-        swap(data_, other.data_);
+        swap(storage_, other.storage_);
         swap(size_, other.size_);
         swap(capacity_, other.capacity_);
     }
@@ -160,7 +326,7 @@ public:
     {
         assert(!empty() && "front() called on empty vector");
 
-        return data_[0];
+        return storage_.data[0];
     }
 
     reference back()
@@ -172,7 +338,7 @@ public:
     {
         assert(!empty() && "back() called on empty vector");
 
-        return data_[size() - 1];
+        return storage_.data[size() - 1];
     }
 
     reference operator[](size_type pos)
@@ -184,7 +350,7 @@ public:
     {
         assert(pos < size() && "operator[] index out of range");
 
-        return data_[pos];
+        return storage_.data[pos];
     }
 
     reference at(size_type pos)
@@ -200,6 +366,211 @@ public:
         return (*this)[pos];
     }
 
+    void clear() noexcept
+    {
+        truncate(0);
+    }
+
+    void resize(size_type count)
+    {
+        if (count <= size())
+        {
+            truncate(count);
+        }
+        else
+        {
+            reserve(count);
+            uninitialized_value_construct_n(end(), count - size());
+            size_ = count;
+        }
+    }
+
+    void resize(size_type count, const value_type& value)
+    {
+        if (count <= size())
+        {
+            truncate(count);
+        }
+        else if (count > capacity())
+        {
+            // The new elements are constructed before the existing ones are
+            // relocated since value may refer to one of them.
+            auto new_vec = vector(allocate_tag{}, count, get_allocator());
+            auto first = new_vec.data() + size();
+            auto last = uninitialized_fill_n(first, count - size(), value);
+            detail::rollback_guard guard{[=] {destroy(first, last);}};
+            new_vec.relocate_from(*this);
+            guard.release();
+            new_vec.size_ = count;
+            swap(new_vec);
+        }
+        else
+        {
+            uninitialized_fill_n(end(), count - size(), value);
+            size_ = count;
+        }
+    }
+
+    void push_back(const T& value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value)
+    {
+        emplace_back(move(value));
+    }
+
+    template<typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+        if (size() == capacity())
+        {
+            // The new element is constructed before the existing ones are
+            // relocated since args may refer to one of them.
+            auto new_vec =
+                vector(allocate_tag{}, grown_capacity(), get_allocator());
+            auto element = construct_at(new_vec.data() + size(),
+                                        forward<Args>(args)...);
+            detail::rollback_guard guard{[=] {destroy_at(element);}};
+            new_vec.relocate_from(*this);
+            guard.release();
+            ++new_vec.size_;
+            swap(new_vec);
+        }
+        else
+        {
+            construct_at(storage_.data + size_, forward<Args>(args)...);
+            ++size_;
+        }
+
+        return back();
+    }
+
+    void pop_back()
+    {
+        assert(!empty() && "pop_back() called on empty vector");
+
+        destroy_at(storage_.data + --size_);
+    }
+
+    iterator insert(const_iterator pos, const T& value)
+    {
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, T&& value)
+    {
+        return emplace(pos, move(value));
+    }
+
+    iterator insert(const_iterator pos, size_type count, const T& value)
+    {
+        auto index = pos - begin();
+
+        if (count > 0)
+        {
+            // value may refer to one of the elements that are about to be
+            // relocated.
+            const auto copy = value;
+            insert_constructed(index, count, [&](T* d_first) {
+                uninitialized_fill_n(d_first, count, copy);
+            });
+        }
+
+        return begin() + index;
+    }
+
+    template<typename InputIt,
+             typename = detail::require_input_iterator<InputIt>>
+    iterator insert(const_iterator pos, InputIt first, InputIt last)
+    {
+        auto index = pos - begin();
+
+        if constexpr (detail::is_forward_iterator_v<InputIt>)
+        {
+            if (auto count = size_t(distance(first, last)); count > 0)
+            {
+                insert_constructed(index, count, [&](T* d_first) {
+                    uninitialized_copy(first, last, d_first);
+                });
+            }
+        }
+        else
+        {
+            // The number of elements is unknown up front so append them and
+            // rotate them into place afterwards.
+            auto old_size = size();
+            append(first, last);
+            rotate(begin() + index, begin() + old_size, end());
+        }
+
+        return begin() + index;
+    }
+
+    iterator insert(const_iterator pos, std::initializer_list<T> il)
+    {
+        return insert(pos, il.begin(), il.end());
+    }
+
+    template<typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args)
+    {
+        auto index = pos - begin();
+
+        if (pos == end())
+        {
+            emplace_back(forward<Args>(args)...);
+        }
+        else
+        {
+            // The new element is constructed up front since args may refer to
+            // one of the elements that are about to be relocated.
+            alignas(T) unsigned char buffer[sizeof(T)];
+            auto element = construct_at(reinterpret_cast<T*>(buffer),
+                                        forward<Args>(args)...);
+            detail::rollback_guard guard{[=] {destroy_at(element);}};
+            insert_constructed(index, 1, [&](T* d_first) {
+                detail::relocate(element, element + 1, d_first);
+                guard.release();
+            });
+        }
+
+        return begin() + index;
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        return erase(pos, pos + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        auto index = first - begin();
+        auto count = last - first;
+
+        if (count > 0)
+        {
+            auto erased = begin() + index;
+
+            if constexpr (is_trivially_relocatable_v<T>)
+            {
+                destroy(erased, erased + count);
+                detail::relocate(erased + count, end(), erased);
+                size_ -= count;
+            }
+            else
+            {
+                // Every element stays alive while the tail is shifted, so
+                // this vector is still valid if an assignment throws.
+                move(erased + count, end(), erased);
+                truncate(size() - count);
+            }
+        }
+
+        return begin() + index;
+    }
+
     T* data() noexcept
     {
         return const_cast<T*>(const_cast<const vector*>(this)->data());
@@ -207,35 +578,780 @@ public:
 
     const T* data() const noexcept
     {
-        return data_;
+        return storage_.data;
     }
 
 private:
 
     struct allocate_tag{};
 
-    vector(allocate_tag, size_t count)
-        : data_{static_cast<value_type*>(
-                    ::operator new[](count * sizeof(value_type)))},
-          size_{count}, capacity_{count}
+    // Allocates storage for capacity elements without constructing any of
+    // them. capacity is taken as a size_t so that values that do not fit in
+    // size_type can be detected.
+    vector(allocate_tag, size_t capacity, const Allocator& alloc)
+        : storage_{alloc}, size_{0}, capacity_{check_size(capacity)}
+    {
+        if (capacity > 0)
+            storage_.data = storage_.allocate(capacity);
+    }
+
+    static size_type check_size(size_t count) noexcept
+    {
+        if (count > max_size())
+            abort();
+
+        return count;
+    }
+
+    // The allocator is a base of the struct holding the data pointer so that
+    // stateless allocators take up no space.
+    struct storage : Allocator
+    {
+        explicit storage(const Allocator& alloc) noexcept
+            : Allocator(alloc), data{nullptr}
+        {
+        }
+
+        value_type* data;
+    };
+
+    size_type grown_capacity() const noexcept
+    {
+        return detail::grown_capacity(capacity_, max_size());
+    }
+
+    // Returns the capacity to grow to in order to fit new_size elements.
+    size_t capacity_for(size_t new_size) const noexcept
+    {
+        size_t grown = grown_capacity();
+        return new_size > grown ? new_size : grown;
+    }
+
+    // Moves all elements of other into the uninitialized storage at the start
+    // of this vector, leaving other without elements.
+    void relocate_from(vector& other)
     {
+        detail::relocate_if_noexcept(other.begin(), other.end(), data());
+        size_ = other.size();
+        other.size_ = 0;
     }
 
-    value_type* data_;
+    // Inserts count elements at index and commits them to size() once they
+    // are all in place. construct(d_first) has to construct the new elements
+    // in the uninitialized storage at d_first and must not leave any of them
+    // behind if it throws.
+    template<typename Construct>
+    void insert_constructed(size_type index, size_t count, Construct construct)
+    {
+        auto new_size = size_t(size()) + count;
+
+        if (new_size > capacity())
+        {
+            // The old elements are only destroyed once all elements are in
+            // the new storage, so this vector is left unchanged if moving, or
+            // copying if moving might throw, throws.
+            auto new_vec = vector(allocate_tag{}, capacity_for(new_size),
+                                  get_allocator());
+            auto front = new_vec.data();
+            auto gap = front + index;
+            construct(gap);
+            detail::rollback_guard gap_guard{[=] {destroy(gap, gap + count);}};
+
+            if constexpr (is_trivially_relocatable_v<T>)
+            {
+                detail::relocate(begin(), begin() + index, front);
+                detail::relocate(begin() + index, end(), gap + count);
+                size_ = 0;
+            }
+            else
+            {
+                auto front_end = detail::uninitialized_move_if_noexcept(
+                    begin(), begin() + index, front);
+                detail::rollback_guard front_guard{
+                    [=] {destroy(front, front_end);}};
+                detail::uninitialized_move_if_noexcept(begin() + index, end(),
+                                                       gap + count);
+                front_guard.release();
+                truncate(0);
+            }
+
+            gap_guard.release();
+            new_vec.size_ = new_size;
+            swap(new_vec);
+        }
+        else if constexpr (is_trivially_relocatable_v<T>)
+        {
+            // Shifting the tail cannot throw, so it is simply shifted back if
+            // constructing the new elements does.
+            auto gap = begin() + index;
+            auto tail = end() - gap;
+            detail::relocate_backward(gap, end(), end() + count);
+            detail::rollback_guard guard{[=] {
+                detail::relocate(gap + count, gap + count + tail, gap);
+            }};
+            construct(gap);
+            guard.release();
+            size_ = new_size;
+        }
+        else
+        {
+            // Moving elements might throw, so the new elements are appended
+            // and rotated into place, which keeps every element alive.
+            auto old_end = end();
+            construct(old_end);
+            size_ = new_size;
+            rotate(begin() + index, old_end, end());
+        }
+    }
+
+    template<typename InputIt>
+    void append(InputIt first, InputIt last)
+    {
+        if constexpr (detail::is_forward_iterator_v<InputIt>)
+        {
+            auto new_size = size_t(size()) + size_t(distance(first, last));
+
+            if (new_size > capacity())
+                reallocate(capacity_for(new_size));
+
+            uninitialized_copy(first, last, end());
+            size_ = new_size;
+        }
+        else
+        {
+            for (; first != last; ++first)
+                emplace_back(*first);
+        }
+    }
+
+    // Destroys all elements from index count onwards.
+    void truncate(size_type count) noexcept
+    {
+        destroy(begin() + count, end());
+        size_ = count;
+    }
+
+    void reallocate(size_t new_capacity)
+    {
+        auto new_vec = vector(allocate_tag{}, new_capacity, get_allocator());
+        new_vec.relocate_from(*this);
+        swap(new_vec);
+    }
+
+    storage storage_;
     size_type size_;
     size_type capacity_;
 };
 
+namespace detail
+{
+
+template<typename Word>
+class bit_reference
+{
+public:
+
+    bit_reference(Word* word, Word mask) noexcept : word_{word}, mask_{mask}
+    {
+    }
+
+    bit_reference(const bit_reference&) = default;
+
+    operator bool() const noexcept
+    {
+        return (*word_ & mask_) != 0;
+    }
+
+    bool operator~() const noexcept
+    {
+        return !bool(*this);
+    }
+
+    bit_reference& operator=(bool value) noexcept
+    {
+        if (value)
+            *word_ |= mask_;
+        else
+            *word_ &= ~mask_;
+
+        return *this;
+    }
+
+    bit_reference& operator=(const bit_reference& other) noexcept
+    {
+        return *this = bool(other);
+    }
+
+    void flip() noexcept
+    {
+        *word_ ^= mask_;
+    }
+
+private:
+
+    Word* word_;
+    Word mask_;
+};
+
+// Iterator over the bits of an array of Words. Word may be const, in which
+// case dereferencing yields a bool instead of a bit_reference.
+template<typename Word>
+class bit_iterator
+{
+public:
+
+    using value_type = bool;
+    using difference_type = ptrdiff_t;
+    using pointer = void;
+    using reference = conditional_t<is_const_v<Word>, bool,
+                                    bit_reference<Word>>;
+    using iterator_category = random_access_iterator_tag;
+
+    static constexpr size_t bits_per_word = sizeof(Word) * __CHAR_BIT__;
+
+    bit_iterator() noexcept : words_{nullptr}, pos_{0}
+    {
+    }
+
+    bit_iterator(Word* words, size_t pos) noexcept : words_{words}, pos_{pos}
+    {
+    }
+
+    // Allows converting an iterator to a const_iterator.
+    template<typename W,
+             typename = enable_if_t<is_same_v<const W, Word>>>
+    bit_iterator(const bit_iterator<W>& other) noexcept
+        : words_{other.words()}, pos_{other.pos()}
+    {
+    }
+
+    reference operator*() const noexcept
+    {
+        auto word = words_ + pos_ / bits_per_word;
+        auto mask = remove_const_t<Word>(1) << (pos_ % bits_per_word);
+
+        if constexpr (is_const_v<Word>)
+            return (*word & mask) != 0;
+        else
+            return reference{word, mask};
+    }
+
+    reference operator[](difference_type n) const noexcept
+    {
+        return *(*this + n);
+    }
+
+    bit_iterator& operator++() noexcept
+    {
+        ++pos_;
+        return *this;
+    }
+
+    bit_iterator& operator--() noexcept
+    {
+        --pos_;
+        return *this;
+    }
+
+    bit_iterator operator++(int) noexcept
+    {
+        auto tmp = *this;
+        ++pos_;
+        return tmp;
+    }
+
+    bit_iterator operator--(int) noexcept
+    {
+        auto tmp = *this;
+        --pos_;
+        return tmp;
+    }
+
+    bit_iterator& operator+=(difference_type n) noexcept
+    {
+        pos_ += n;
+        return *this;
+    }
+
+    bit_iterator& operator-=(difference_type n) noexcept
+    {
+        pos_ -= n;
+        return *this;
+    }
+
+    friend bit_iterator operator+(bit_iterator it, difference_type n) noexcept
+    {
+        return it += n;
+    }
+
+    friend bit_iterator operator+(difference_type n, bit_iterator it) noexcept
+    {
+        return it += n;
+    }
+
+    friend bit_iterator operator-(bit_iterator it, difference_type n) noexcept
+    {
+        return it -= n;
+    }
+
+    friend difference_type operator-(const bit_iterator& lhs,
+                                     const bit_iterator& rhs) noexcept
+    {
+        return difference_type(lhs.pos_) - difference_type(rhs.pos_);
+    }
+
+    friend bool operator==(const bit_iterator& lhs,
+                           const bit_iterator& rhs) noexcept
+    {
+        return lhs.pos_ == rhs.pos_;
+    }
+
+    friend bool operator!=(const bit_iterator& lhs,
+                           const bit_iterator& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const bit_iterator& lhs,
+                          const bit_iterator& rhs) noexcept
+    {
+        return lhs.pos_ < rhs.pos_;
+    }
+
+    friend bool operator>(const bit_iterator& lhs,
+                          const bit_iterator& rhs) noexcept
+    {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(const bit_iterator& lhs,
+                           const bit_iterator& rhs) noexcept
+    {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>=(const bit_iterator& lhs,
+                           const bit_iterator& rhs) noexcept
+    {
+        return !(lhs < rhs);
+    }
+
+    Word* words() const noexcept
+    {
+        return words_;
+    }
+
+    size_t pos() const noexcept
+    {
+        return pos_;
+    }
+
+private:
+
+    Word* words_;
+    size_t pos_;
+};
+
+} // namespace detail
+
+// Stores one bit per element in an array of words. Bits beyond size() in the
+// last word are always kept zero so that whole words can be counted and
+// searched without masking.
+template<typename Allocator, typename SizeType>
+class vector<bool, Allocator, SizeType>
+{
+    using word_type = size_t;
+    using word_allocator =
+        typename Allocator::template rebind<word_type>::other;
+    using word_vector = vector<word_type, word_allocator, SizeType>;
+
+    static constexpr size_t bits_per_word = sizeof(word_type) * __CHAR_BIT__;
+
+public:
+
+    using value_type = bool;
+    using allocator_type = Allocator;
+    using size_type = SizeType;
+    using difference_type = ptrdiff_t;
+    using reference = detail::bit_reference<word_type>;
+    using const_reference = bool;
+    using iterator = detail::bit_iterator<word_type>;
+    using const_iterator = detail::bit_iterator<const word_type>;
+    using reverse_iterator = STDAVR_NAMESPACE::reverse_iterator<iterator>;
+    using const_reverse_iterator =
+        STDAVR_NAMESPACE::reverse_iterator<const_iterator>;
+
+    vector() : vector(Allocator())
+    {
+    }
+
+    explicit vector(const Allocator& alloc) noexcept
+        : words_{word_allocator(alloc)}, size_{0}
+    {
+    }
+
+    vector(size_type count, bool value, const Allocator& alloc = Allocator())
+        : vector(alloc)
+    {
+        resize(count, value);
+    }
+
+    explicit vector(size_type count, const Allocator& alloc = Allocator())
+        : vector(count, false, alloc)
+    {
+    }
+
+    vector(std::initializer_list<bool> il,
+           const Allocator& alloc = Allocator())
+        : vector(il.begin(), il.end(), alloc)
+    {
+    }
+
+    template<typename InputIt,
+             typename = detail::require_input_iterator<InputIt>>
+    vector(InputIt first, InputIt last, const Allocator& alloc = Allocator())
+        : vector(alloc)
+    {
+        for (; first != last; ++first)
+            push_back(*first);
+    }
+
+    vector& operator=(std::initializer_list<bool> il)
+    {
+        auto vec = vector(il, get_allocator());
+        swap(vec);
+        return *this;
+    }
+
+    allocator_type get_allocator() const noexcept
+    {
+        return words_.get_allocator();
+    }
+
+    size_type size() const noexcept
+    {
+        return size_;
+    }
+
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    size_type capacity() const noexcept
+    {
+        auto bits = size_t(words_.capacity()) * bits_per_word;
+        return bits < max_size() ? bits : max_size();
+    }
+
+    static constexpr size_type max_size() noexcept
+    {
+        return size_type(-1);
+    }
+
+    void reserve(size_type new_capacity)
+    {
+        words_.reserve(words_for(new_capacity));
+    }
+
+    void shrink_to_fit()
+    {
+        words_.shrink_to_fit();
+    }
+
+    iterator begin() noexcept
+    {
+        return iterator{words_.data(), 0};
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return const_iterator{words_.data(), 0};
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    iterator end() noexcept
+    {
+        return begin() + size_;
+    }
+
+    const_iterator end() const noexcept
+    {
+        return begin() + size_;
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return end();
+    }
+
+    reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator crbegin() const noexcept
+    {
+        return rbegin();
+    }
+
+    reverse_iterator rend() noexcept
+    {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    const_reverse_iterator crend() const noexcept
+    {
+        return rend();
+    }
+
+    void swap(vector& other)
+    {
+        using STDAVR_NAMESPACE::swap;
+        words_.swap(other.words_);
+        swap(size_, other.size_);
+    }
+
+    reference front()
+    {
+        assert(!empty() && "front() called on empty vector");
+
+        return *begin();
+    }
+
+    const_reference front() const
+    {
+        assert(!empty() && "front() called on empty vector");
+
+        return *begin();
+    }
+
+    reference back()
+    {
+        assert(!empty() && "back() called on empty vector");
+
+        return *(end() - 1);
+    }
+
+    const_reference back() const
+    {
+        assert(!empty() && "back() called on empty vector");
+
+        return *(end() - 1);
+    }
+
+    reference operator[](size_type pos)
+    {
+        assert(pos < size() && "operator[] index out of range");
+
+        return begin()[pos];
+    }
+
+    const_reference operator[](size_type pos) const
+    {
+        assert(pos < size() && "operator[] index out of range");
+
+        return begin()[pos];
+    }
+
+    reference at(size_type pos)
+    {
+        if (pos >= size())
+            abort();
+
+        return (*this)[pos];
+    }
+
+    const_reference at(size_type pos) const
+    {
+        if (pos >= size())
+            abort();
+
+        return (*this)[pos];
+    }
+
+    void clear() noexcept
+    {
+        words_.clear();
+        size_ = 0;
+    }
+
+    void resize(size_type count, bool value = false)
+    {
+        auto old_size = size_;
+        words_.resize(words_for(count));
+        size_ = count;
+
+        if (count > old_size)
+            fill(old_size, count, value);
+        else
+            clear_unused_bits();
+    }
+
+    void push_back(bool value)
+    {
+        if (size_ == max_size())
+            abort();
+
+        if (size_ % bits_per_word == 0)
+            words_.push_back(0);
+
+        ++size_;
+        back() = value;
+    }
+
+    template<typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+        push_back(bool(forward<Args>(args)...));
+        return back();
+    }
+
+    void pop_back()
+    {
+        assert(!empty() && "pop_back() called on empty vector");
+
+        back() = false;
+        --size_;
+
+        if (size_ % bits_per_word == 0)
+            words_.pop_back();
+    }
+
+    // Flips all bits.
+    void flip() noexcept
+    {
+        for (auto& word : words_)
+            word = ~word;
+
+        clear_unused_bits();
+    }
+
+    // Sets all bits in [first, last) to value. Whole words in the range are
+    // set at once.
+    void fill(size_type first, size_type last, bool value) noexcept
+    {
+        assert(first <= last && last <= size() && "fill() range out of range");
+
+        // An empty range may start one word past the last one.
+        if (first == last)
+            return;
+
+        auto first_word = first / bits_per_word;
+        auto last_word = last / bits_per_word;
+        auto first_mask = ~word_type(0) << (first % bits_per_word);
+        auto last_mask = ~(~word_type(0) << (last % bits_per_word));
+
+        if (first_word == last_word)
+        {
+            set_bits(first_word, first_mask & last_mask, value);
+            return;
+        }
+
+        set_bits(first_word, first_mask, value);
+        memset(words_.data() + first_word + 1, value ? 0xff : 0,
+               (last_word - first_word - 1) * sizeof(word_type));
+
+        if (last_mask != 0)
+            set_bits(last_word, last_mask, value);
+    }
+
+    // Returns the number of set bits.
+    size_type count() const noexcept
+    {
+        size_t result = 0;
+
+        for (auto word : words_)
+            result += popcount(word);
+
+        return result;
+    }
+
+    // Returns the index of the first set bit or size() if there is none.
+    size_type find_first() const noexcept
+    {
+        return find_next(0);
+    }
+
+    // Returns the index of the first set bit at or after pos or size() if
+    // there is none.
+    size_type find_next(size_type pos) const noexcept
+    {
+        if (pos >= size())
+            return size();
+
+        auto word_index = pos / bits_per_word;
+        auto word = words_[word_index] &
+                    (~word_type(0) << (pos % bits_per_word));
+
+        while (word == 0)
+        {
+            if (++word_index == words_.size())
+                return size();
+
+            word = words_[word_index];
+        }
+
+        return word_index * bits_per_word + countr_zero(word);
+    }
+
+private:
+
+    static size_t words_for(size_t bits) noexcept
+    {
+        return (bits + bits_per_word - 1) / bits_per_word;
+    }
+
+    void set_bits(size_t word_index, word_type mask, bool value) noexcept
+    {
+        if (value)
+            words_[word_index] |= mask;
+        else
+            words_[word_index] &= ~mask;
+    }
+
+    void clear_unused_bits() noexcept
+    {
+        if (auto used = size_ % bits_per_word; used != 0)
+            words_.back() &= ~(~word_type(0) << used);
+    }
+
+    word_vector words_;
+    size_type size_;
+};
+
 template<typename InputIt>
 vector(InputIt, InputIt)
     -> vector<typename iterator_traits<InputIt>::value_type>;
 
-template<class T>
-void swap(vector<T>& lhs, vector<T>& rhs) noexcept(noexcept(lhs.swap(rhs)))
+template<class T, class Allocator, class SizeType>
+void swap(vector<T, Allocator, SizeType>& lhs,
+          vector<T, Allocator, SizeType>& rhs)
+    noexcept(noexcept(lhs.swap(rhs)))
 {
     lhs.swap(rhs);
 }
 
+// A vector only refers to its elements through a pointer so it can be
+// relocated as long as its allocator can.
+template<class T, class Allocator, class SizeType>
+struct is_trivially_relocatable<vector<T, Allocator, SizeType>>
+    : is_trivially_relocatable<Allocator> {};
+
 }
 
 #endif
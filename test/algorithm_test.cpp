@@ -1,8 +1,18 @@
 #include "gmock/gmock.h"
 
 #include "sut/algorithm"
+#include "sut/numeric"
+#include "sut/vector"
+
+#include "test_iterators.hpp"
 
 #include <iterator>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <cstring>
+#include <numeric>
 
 using namespace testing;
 
@@ -33,3 +43,1498 @@ TEST(copy, returns_end_of_output_iterator)
 
     ASSERT_THAT(out_end, Eq(std::end(array)));
 }
+
+namespace
+{
+
+struct some_class_type
+{
+    int value;
+
+    bool operator==(const some_class_type& other) const
+    {
+        return value == other.value;
+    }
+};
+
+struct move_only
+{
+    move_only(int value) : value{value} {}
+    move_only(move_only&&) = default;
+    move_only& operator=(move_only&&) = default;
+
+    int value;
+};
+
+using byte = unsigned char;
+
+}
+
+TEST(copy, copies_elements_through_non_pointer_iterators)
+{
+    some_class_type source[] = {{1}, {2}, {3}};
+    auto destination = std::vector<some_class_type>(3);
+
+    auto out_end = sut::copy(std::begin(source), std::end(source),
+                             destination.begin());
+
+    ASSERT_THAT(out_end, Eq(destination.end()));
+    ASSERT_THAT(destination, ElementsAreArray(source));
+}
+
+TEST(copy, copies_to_an_overlapping_range_before_the_source)
+{
+    some_type array[] = {1, 2, 3, 4, 5};
+
+    sut::copy(array + 1, array + 5, array);
+
+    ASSERT_THAT(array, ElementsAre(2, 3, 4, 5, 5));
+}
+
+TEST(copy_n, copies_count_elements)
+{
+    some_type array[3] = {};
+
+    auto out_end = sut::copy_n(std::begin(some_array), 3, std::begin(array));
+
+    ASSERT_THAT(out_end, Eq(std::end(array)));
+    ASSERT_THAT(array, ElementsAre(1, 4, 3));
+}
+
+TEST(copy_n, copies_nothing_for_a_negative_count)
+{
+    some_type array[] = {0};
+
+    auto out_end = sut::copy_n(std::begin(some_array), -1, std::begin(array));
+
+    ASSERT_THAT(out_end, Eq(std::begin(array)));
+    ASSERT_THAT(array, ElementsAre(0));
+}
+
+TEST(copy_backward, copies_to_an_overlapping_range_after_the_source)
+{
+    some_type array[] = {1, 2, 3, 4, 5};
+
+    auto out_first = sut::copy_backward(array, array + 4, array + 5);
+
+    ASSERT_THAT(out_first, Eq(array + 1));
+    ASSERT_THAT(array, ElementsAre(1, 1, 2, 3, 4));
+}
+
+TEST(copy_backward, copies_elements_through_non_pointer_iterators)
+{
+    some_class_type array[] = {{1}, {2}, {3}};
+    auto destination = std::vector<some_class_type>(4);
+
+    sut::copy_backward(std::begin(array), std::end(array), destination.end());
+
+    ASSERT_THAT(destination, ElementsAre(some_class_type{0},
+                                         some_class_type{1},
+                                         some_class_type{2},
+                                         some_class_type{3}));
+}
+
+TEST(move, moves_elements)
+{
+    move_only source[] = {1, 2, 3};
+    move_only destination[] = {0, 0, 0};
+
+    sut::move(std::begin(source), std::end(source), std::begin(destination));
+
+    ASSERT_THAT(destination[2].value, Eq(3));
+}
+
+TEST(move_backward, moves_elements_to_an_overlapping_range_after_the_source)
+{
+    move_only array[] = {1, 2, 3, 4};
+
+    sut::move_backward(array, array + 3, array + 4);
+
+    ASSERT_THAT(array[1].value, Eq(1));
+    ASSERT_THAT(array[3].value, Eq(3));
+}
+
+TEST(move_backward, moves_trivially_copyable_elements)
+{
+    some_type array[] = {1, 2, 3, 4};
+
+    sut::move_backward(array, array + 2, array + 4);
+
+    ASSERT_THAT(array, ElementsAre(1, 2, 1, 2));
+}
+
+TEST(fill, assigns_the_value_to_all_elements)
+{
+    some_type array[4] = {};
+
+    sut::fill(std::begin(array), std::end(array), 7);
+
+    ASSERT_THAT(array, Each(Eq(7)));
+}
+
+TEST(fill, converts_the_value_for_byte_ranges)
+{
+    byte array[5] = {};
+
+    sut::fill(std::begin(array), std::end(array), 0x1a5);
+
+    ASSERT_THAT(array, Each(Eq(0xa5)));
+}
+
+TEST(fill, assigns_true_to_bool_ranges)
+{
+    bool array[3] = {};
+
+    sut::fill(std::begin(array), std::end(array), 2);
+
+    ASSERT_THAT(array, Each(Eq(true)));
+}
+
+TEST(fill_n, assigns_the_value_to_count_elements)
+{
+    byte array[4] = {};
+
+    auto out_end = sut::fill_n(std::begin(array), 3, byte{9});
+
+    ASSERT_THAT(out_end, Eq(std::begin(array) + 3));
+    ASSERT_THAT(array, ElementsAre(9, 9, 9, 0));
+}
+
+TEST(fill_n, assigns_nothing_for_a_zero_count)
+{
+    byte array[1] = {};
+
+    auto out_end = sut::fill_n(std::begin(array), 0, byte{9});
+
+    ASSERT_THAT(out_end, Eq(std::begin(array)));
+    ASSERT_THAT(array, ElementsAre(0));
+}
+
+namespace
+{
+
+// Returns n pseudo-random values in [0, range).
+std::vector<some_type> random_values(std::size_t n, some_type range)
+{
+    auto values = std::vector<some_type>(n);
+    std::uint32_t state = 12345;
+
+    for (auto& value : values)
+    {
+        state = state * 1103515245 + 12345;
+        value = some_type((state >> 16) % range);
+    }
+
+    return values;
+}
+
+struct keyed
+{
+    some_type key;
+    std::size_t index;
+};
+
+struct greater
+{
+    bool operator()(some_type lhs, some_type rhs) const
+    {
+        return lhs > rhs;
+    }
+};
+
+bool key_less(const keyed& lhs, const keyed& rhs)
+{
+    return lhs.key < rhs.key;
+}
+
+}
+
+TEST(is_sorted, is_true_for_an_empty_range)
+{
+    ASSERT_TRUE(sut::is_sorted(std::begin(some_array), std::begin(some_array)));
+}
+
+TEST(is_sorted, is_true_for_a_non_descending_range)
+{
+    some_type array[] = {1, 2, 2, 5};
+
+    ASSERT_TRUE(sut::is_sorted(std::begin(array), std::end(array)));
+}
+
+TEST(is_sorted, is_false_for_an_unsorted_range)
+{
+    ASSERT_FALSE(sut::is_sorted(std::begin(some_array), std::end(some_array)));
+}
+
+TEST(is_sorted, uses_the_given_comparison)
+{
+    some_type array[] = {5, 3, 3, 1};
+
+    ASSERT_TRUE(sut::is_sorted(std::begin(array), std::end(array),
+                               greater()));
+}
+
+TEST(is_sorted_until, returns_the_first_out_of_order_element)
+{
+    auto until = sut::is_sorted_until(std::begin(some_array),
+                                      std::end(some_array));
+
+    ASSERT_THAT(until, Eq(std::begin(some_array) + 2));
+}
+
+TEST(sort, sorts_a_small_range)
+{
+    some_type array[] = {1, 4, 3, 7, 9};
+
+    sut::sort(std::begin(array), std::end(array));
+
+    ASSERT_THAT(array, ElementsAre(1, 3, 4, 7, 9));
+}
+
+TEST(sort, sorts_large_random_ranges)
+{
+    for (auto n : {17u, 100u, 1000u})
+    {
+        auto values = random_values(n, 50);
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        sut::sort(values.data(), values.data() + values.size());
+
+        ASSERT_THAT(values, ElementsAreArray(expected));
+    }
+}
+
+TEST(sort, sorts_reversed_and_constant_ranges)
+{
+    auto reversed = std::vector<some_type>(500);
+    auto constant = std::vector<some_type>(500, some_type{3});
+    for (std::size_t i = 0; i < reversed.size(); ++i)
+        reversed[i] = some_type(reversed.size() - i);
+
+    sut::sort(reversed.data(), reversed.data() + reversed.size());
+    sut::sort(constant.data(), constant.data() + constant.size());
+
+    ASSERT_TRUE(std::is_sorted(reversed.begin(), reversed.end()));
+    ASSERT_THAT(constant, Each(Eq(3)));
+}
+
+TEST(sort, uses_the_given_comparison)
+{
+    auto values = random_values(100, 1000);
+
+    sut::sort(values.data(), values.data() + values.size(), greater());
+
+    ASSERT_TRUE(std::is_sorted(values.begin(), values.end(),
+                               greater()));
+}
+
+TEST(stable_sort, sorts_large_random_ranges)
+{
+    auto values = random_values(1000, 1000);
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    sut::stable_sort(values.data(), values.data() + values.size());
+
+    ASSERT_THAT(values, ElementsAreArray(expected));
+}
+
+TEST(stable_sort, keeps_the_order_of_equivalent_elements)
+{
+    auto keys = random_values(300, 10);
+    auto values = std::vector<keyed>();
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        values.push_back({keys[i], i});
+
+    sut::stable_sort(values.data(), values.data() + values.size(),
+                     key_less);
+
+    for (std::size_t i = 1; i < values.size(); ++i)
+    {
+        ASSERT_THAT(values[i - 1].key, Le(values[i].key));
+
+        if (values[i - 1].key == values[i].key)
+        {
+            ASSERT_THAT(values[i - 1].index, Lt(values[i].index));
+        }
+    }
+}
+
+namespace
+{
+
+some_type some_sorted_array[] = {1, 3, 3, 3, 5, 8};
+
+struct some_key
+{
+    some_type value;
+};
+
+bool operator<(some_key lhs, some_key rhs)
+{
+    return lhs.value < rhs.value;
+}
+
+}
+
+TEST(lower_bound, returns_the_first_element_not_less_than_the_value)
+{
+    auto it = sut::lower_bound(std::begin(some_sorted_array),
+                               std::end(some_sorted_array), 3);
+
+    ASSERT_THAT(it, Eq(std::begin(some_sorted_array) + 1));
+}
+
+TEST(lower_bound, returns_last_when_all_elements_are_less_than_the_value)
+{
+    auto it = sut::lower_bound(std::begin(some_sorted_array),
+                               std::end(some_sorted_array), 9);
+
+    ASSERT_THAT(it, Eq(std::end(some_sorted_array)));
+}
+
+TEST(lower_bound, returns_first_for_an_empty_range)
+{
+    auto it = sut::lower_bound(std::begin(some_sorted_array),
+                               std::begin(some_sorted_array), 3);
+
+    ASSERT_THAT(it, Eq(std::begin(some_sorted_array)));
+}
+
+TEST(lower_bound, agrees_with_std_for_every_value_and_size)
+{
+    for (std::size_t n = 0; n <= std::size(some_sorted_array); ++n)
+    {
+        auto first = std::begin(some_sorted_array);
+        auto last = first + n;
+
+        for (some_type value = 0; value <= 9; ++value)
+        {
+            ASSERT_THAT(sut::lower_bound(first, last, value),
+                        Eq(std::lower_bound(first, last, value)));
+            ASSERT_THAT(sut::upper_bound(first, last, value),
+                        Eq(std::upper_bound(first, last, value)));
+        }
+    }
+}
+
+TEST(lower_bound, supports_forward_iterators)
+{
+    auto [first, last] = make_range<forward_iterator>(some_sorted_array);
+
+    auto it = sut::lower_bound(first, last, 4);
+
+    ASSERT_THAT(it.base(), Eq(std::begin(some_sorted_array) + 4));
+}
+
+TEST(lower_bound, uses_the_given_comparison)
+{
+    some_key keys[] = {{1}, {4}, {6}};
+
+    auto it = sut::lower_bound(std::begin(keys), std::end(keys), some_key{4},
+                               [](some_key lhs, some_key rhs) {
+                                   return lhs.value < rhs.value;
+                               });
+
+    ASSERT_THAT(it, Eq(std::begin(keys) + 1));
+}
+
+TEST(upper_bound, returns_the_first_element_greater_than_the_value)
+{
+    auto it = sut::upper_bound(std::begin(some_sorted_array),
+                               std::end(some_sorted_array), 3);
+
+    ASSERT_THAT(it, Eq(std::begin(some_sorted_array) + 4));
+}
+
+TEST(upper_bound, supports_class_types)
+{
+    some_key keys[] = {{1}, {4}, {4}, {6}};
+
+    auto it = sut::upper_bound(std::begin(keys), std::end(keys), some_key{4});
+
+    ASSERT_THAT(it, Eq(std::begin(keys) + 3));
+}
+
+TEST(upper_bound, supports_forward_iterators)
+{
+    auto [first, last] = make_range<forward_iterator>(some_sorted_array);
+
+    auto it = sut::upper_bound(first, last, 3);
+
+    ASSERT_THAT(it.base(), Eq(std::begin(some_sorted_array) + 4));
+}
+
+TEST(equal_range, returns_the_range_of_equivalent_elements)
+{
+    auto [first, last] = sut::equal_range(std::begin(some_sorted_array),
+                                          std::end(some_sorted_array), 3);
+
+    ASSERT_THAT(first, Eq(std::begin(some_sorted_array) + 1));
+    ASSERT_THAT(last, Eq(std::begin(some_sorted_array) + 4));
+}
+
+TEST(equal_range, returns_an_empty_range_for_a_missing_value)
+{
+    auto range = sut::equal_range(std::begin(some_sorted_array),
+                                  std::end(some_sorted_array), 4);
+
+    ASSERT_THAT(range.first, Eq(range.second));
+    ASSERT_THAT(range.first, Eq(std::begin(some_sorted_array) + 4));
+}
+
+TEST(binary_search, is_true_for_a_contained_value)
+{
+    ASSERT_TRUE(sut::binary_search(std::begin(some_sorted_array),
+                                   std::end(some_sorted_array), 8));
+}
+
+TEST(binary_search, is_false_for_a_missing_value)
+{
+    ASSERT_FALSE(sut::binary_search(std::begin(some_sorted_array),
+                                    std::end(some_sorted_array), 7));
+}
+
+TEST(is_heap, is_true_for_a_max_heap)
+{
+    some_type heap[] = {9, 5, 8, 1, 3, 2};
+
+    ASSERT_TRUE(sut::is_heap(std::begin(heap), std::end(heap)));
+}
+
+TEST(is_heap, is_false_when_a_child_is_greater_than_its_parent)
+{
+    some_type array[] = {9, 5, 8, 6, 3, 2};
+
+    ASSERT_FALSE(sut::is_heap(std::begin(array), std::end(array)));
+    ASSERT_THAT(sut::is_heap_until(std::begin(array), std::end(array)),
+                Eq(std::begin(array) + 3));
+}
+
+TEST(make_heap, makes_a_heap)
+{
+    auto values = random_values(100, 50);
+
+    sut::make_heap(values.data(), values.data() + values.size());
+
+    ASSERT_TRUE(std::is_heap(values.begin(), values.end()));
+}
+
+TEST(push_heap, keeps_a_heap_when_adding_elements)
+{
+    auto values = random_values(100, 50);
+
+    for (std::size_t n = 1; n <= values.size(); ++n)
+    {
+        sut::push_heap(values.data(), values.data() + n);
+        ASSERT_TRUE(std::is_heap(values.begin(), values.begin() + n));
+    }
+}
+
+TEST(pop_heap, moves_the_greatest_element_to_the_back)
+{
+    some_type heap[] = {9, 5, 8, 1, 3, 2};
+
+    sut::pop_heap(std::begin(heap), std::end(heap));
+
+    ASSERT_THAT(heap[5], Eq(9));
+    ASSERT_TRUE(std::is_heap(std::begin(heap), std::end(heap) - 1));
+}
+
+TEST(sort_heap, sorts_a_heap)
+{
+    auto values = random_values(100, 50);
+    std::make_heap(values.begin(), values.end(), greater());
+
+    sut::sort_heap(values.data(), values.data() + values.size(), greater());
+
+    ASSERT_TRUE(std::is_sorted(values.begin(), values.end(), greater()));
+}
+
+namespace
+{
+
+// Checks that *nth is where it would be in the sorted range and partitions it.
+::testing::AssertionResult is_nth_element(const std::vector<some_type>& values,
+                                          std::size_t nth)
+{
+    auto sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+
+    if (values[nth] != sorted[nth])
+        return AssertionFailure() << "wrong element at " << nth;
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        if ((i < nth && values[i] > values[nth]) ||
+            (i > nth && values[i] < values[nth]))
+        {
+            return AssertionFailure() << "not partitioned at " << i;
+        }
+    }
+
+    return AssertionSuccess();
+}
+
+}
+
+TEST(nth_element, selects_every_element_of_every_permutation_of_tiny_ranges)
+{
+    for (std::size_t n = 1; n <= 6; ++n)
+    {
+        auto permutation = std::vector<some_type>(n);
+        for (std::size_t i = 0; i < n; ++i)
+            permutation[i] = some_type(i / 2);
+
+        do
+        {
+            for (std::size_t nth = 0; nth < n; ++nth)
+            {
+                auto values = permutation;
+                sut::nth_element(values.data(), values.data() + nth,
+                                 values.data() + n);
+                ASSERT_TRUE(is_nth_element(values, nth));
+            }
+        }
+        while (std::next_permutation(permutation.begin(), permutation.end()));
+    }
+}
+
+TEST(nth_element, selects_the_median_of_random_windows)
+{
+    for (auto n : {9u, 31u, 1000u})
+    {
+        auto values = random_values(n, 20);
+
+        sut::nth_element(values.data(), values.data() + n / 2,
+                         values.data() + n);
+
+        ASSERT_TRUE(is_nth_element(values, n / 2));
+    }
+}
+
+TEST(nth_element, does_nothing_when_nth_is_last)
+{
+    some_type array[] = {3, 1, 2};
+
+    sut::nth_element(std::begin(array), std::end(array), std::end(array));
+
+    ASSERT_THAT(array, ElementsAre(3, 1, 2));
+}
+
+TEST(nth_element, uses_the_given_comparison)
+{
+    auto values = random_values(100, 1000);
+
+    sut::nth_element(values.data(), values.data(), values.data() + 100,
+                     greater());
+
+    ASSERT_THAT(values[0], Eq(*std::max_element(values.begin(),
+                                                values.end())));
+}
+
+TEST(partial_sort, sorts_the_smallest_elements_into_the_front)
+{
+    auto values = random_values(200, 1000);
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    sut::partial_sort(values.data(), values.data() + 10,
+                      values.data() + values.size());
+
+    ASSERT_THAT(std::vector<some_type>(values.begin(), values.begin() + 10),
+                ElementsAreArray(expected.data(), 10));
+}
+
+TEST(partial_sort, does_nothing_for_an_empty_middle)
+{
+    some_type array[] = {3, 1, 2};
+
+    sut::partial_sort(std::begin(array), std::begin(array), std::end(array));
+
+    ASSERT_THAT(array, ElementsAre(3, 1, 2));
+}
+
+TEST(partial_sort_copy, copies_the_smallest_elements_sorted)
+{
+    some_type result[3] = {};
+
+    auto end = sut::partial_sort_copy(std::begin(some_array),
+                                      std::end(some_array),
+                                      std::begin(result), std::end(result));
+
+    ASSERT_THAT(end, Eq(std::end(result)));
+    ASSERT_THAT(result, ElementsAre(1, 3, 4));
+    ASSERT_THAT(some_array, ElementsAre(1, 4, 3, 7, 9));
+}
+
+TEST(partial_sort_copy, copies_all_elements_into_a_larger_range)
+{
+    some_type result[7] = {};
+
+    auto end = sut::partial_sort_copy(std::begin(some_array),
+                                      std::end(some_array),
+                                      std::begin(result), std::end(result),
+                                      greater());
+
+    ASSERT_THAT(end, Eq(std::begin(result) + 5));
+    ASSERT_THAT(result, ElementsAre(9, 7, 4, 3, 1, 0, 0));
+}
+
+TEST(partial_sort_copy, supports_input_iterators)
+{
+    auto [first, last] = make_range<input_iterator>(some_array);
+    some_type result[2] = {};
+
+    sut::partial_sort_copy(first, last, std::begin(result), std::end(result));
+
+    ASSERT_THAT(result, ElementsAre(1, 3));
+}
+
+namespace
+{
+
+byte some_frame[] = {0x7e, 0x01, 0x02, 0x7d, 0x5e, 0x03, 0x7e, 0x7e,
+                     0x04, 0x05, 0x06, 0x07, 0x08, 0x7e, 0x09, 0x0a,
+                     0x0b, 0x0c, 0x0d, 0x0e, 0x7e};
+
+bool is_even(some_type x)
+{
+    return x % 2 == 0;
+}
+
+}
+
+TEST(find, returns_the_first_element_equal_to_the_value)
+{
+    ASSERT_THAT(sut::find(std::begin(some_array), std::end(some_array), 7),
+                Eq(std::begin(some_array) + 3));
+}
+
+TEST(find, returns_last_when_no_element_is_equal_to_the_value)
+{
+    ASSERT_THAT(sut::find(std::begin(some_array), std::end(some_array), 2),
+                Eq(std::end(some_array)));
+}
+
+TEST(find, finds_bytes)
+{
+    auto it = sut::find(std::begin(some_frame) + 1, std::end(some_frame),
+                        0x7e);
+
+    ASSERT_THAT(it, Eq(std::begin(some_frame) + 6));
+}
+
+TEST(find, does_not_find_values_that_do_not_fit_in_a_byte)
+{
+    auto it = sut::find(std::begin(some_frame), std::end(some_frame),
+                        0x17e);
+
+    ASSERT_THAT(it, Eq(std::end(some_frame)));
+}
+
+TEST(find, finds_negative_values_in_signed_bytes)
+{
+    signed char bytes[] = {1, -2, 3};
+
+    ASSERT_THAT(sut::find(std::begin(bytes), std::end(bytes), -2),
+                Eq(std::begin(bytes) + 1));
+}
+
+TEST(find, supports_input_iterators)
+{
+    auto [first, last] = make_range<input_iterator>(some_array);
+
+    ASSERT_THAT(sut::find(first, last, 9).base(),
+                Eq(std::begin(some_array) + 4));
+}
+
+TEST(find_if, returns_the_first_element_satisfying_the_predicate)
+{
+    ASSERT_THAT(sut::find_if(std::begin(some_array), std::end(some_array),
+                             is_even),
+                Eq(std::begin(some_array) + 1));
+}
+
+TEST(find_if_not, returns_the_first_element_not_satisfying_the_predicate)
+{
+    some_type array[] = {2, 4, 5};
+
+    ASSERT_THAT(sut::find_if_not(std::begin(array), std::end(array), is_even),
+                Eq(std::begin(array) + 2));
+}
+
+TEST(all_of, is_true_when_all_elements_satisfy_the_predicate)
+{
+    some_type array[] = {2, 4};
+
+    ASSERT_TRUE(sut::all_of(std::begin(array), std::end(array), is_even));
+    ASSERT_FALSE(sut::all_of(std::begin(some_array), std::end(some_array),
+                             is_even));
+}
+
+TEST(any_of, is_true_when_some_element_satisfies_the_predicate)
+{
+    ASSERT_TRUE(sut::any_of(std::begin(some_array), std::end(some_array),
+                            is_even));
+    ASSERT_FALSE(sut::any_of(std::begin(some_array), std::begin(some_array),
+                             is_even));
+}
+
+TEST(none_of, is_true_when_no_element_satisfies_the_predicate)
+{
+    some_type array[] = {1, 3};
+
+    ASSERT_TRUE(sut::none_of(std::begin(array), std::end(array), is_even));
+}
+
+TEST(find_first_of, returns_the_first_element_equal_to_any_of_the_values)
+{
+    some_type values[] = {9, 3};
+
+    ASSERT_THAT(sut::find_first_of(std::begin(some_array),
+                                   std::end(some_array),
+                                   std::begin(values), std::end(values)),
+                Eq(std::begin(some_array) + 2));
+}
+
+TEST(adjacent_find, returns_the_first_of_two_equal_adjacent_elements)
+{
+    ASSERT_THAT(sut::adjacent_find(std::begin(some_frame),
+                                   std::end(some_frame)),
+                Eq(std::begin(some_frame) + 6));
+    ASSERT_THAT(sut::adjacent_find(std::begin(some_array),
+                                   std::end(some_array)),
+                Eq(std::end(some_array)));
+}
+
+TEST(count, counts_the_elements_equal_to_the_value)
+{
+    some_type array[] = {1, 2, 1, 1};
+
+    ASSERT_THAT(sut::count(std::begin(array), std::end(array), 1), Eq(3));
+}
+
+TEST(count, counts_bytes_of_ranges_of_every_size_and_alignment)
+{
+    for (std::size_t offset = 0; offset < 8; ++offset)
+    {
+        for (auto last = std::begin(some_frame) + offset;
+             last <= std::end(some_frame); ++last)
+        {
+            auto first = std::begin(some_frame) + offset;
+
+            ASSERT_THAT(sut::count(first, last, 0x7e),
+                        Eq(std::count(first, last, 0x7e)));
+        }
+    }
+}
+
+TEST(count, counts_no_values_that_do_not_fit_in_a_byte)
+{
+    ASSERT_THAT(sut::count(std::begin(some_frame), std::end(some_frame),
+                           0x17e),
+                Eq(0));
+}
+
+TEST(count_if, counts_the_elements_satisfying_the_predicate)
+{
+    ASSERT_THAT(sut::count_if(std::begin(some_array), std::end(some_array),
+                              is_even),
+                Eq(1));
+}
+
+TEST(mismatch, returns_the_first_differing_elements)
+{
+    some_type array[] = {1, 4, 5, 7, 9};
+
+    auto [it1, it2] = sut::mismatch(std::begin(some_array),
+                                    std::end(some_array), std::begin(array));
+
+    ASSERT_THAT(it1, Eq(std::begin(some_array) + 2));
+    ASSERT_THAT(it2, Eq(std::begin(array) + 2));
+}
+
+TEST(mismatch, finds_the_first_differing_byte_at_every_position)
+{
+    for (std::size_t i = 0; i <= std::size(some_frame); ++i)
+    {
+        byte copy[std::size(some_frame)];
+        std::copy(std::begin(some_frame), std::end(some_frame), copy);
+        if (i < std::size(copy))
+            copy[i] ^= 1;
+
+        auto [it1, it2] = sut::mismatch(std::begin(some_frame),
+                                        std::end(some_frame), copy);
+
+        ASSERT_THAT(it1 - std::begin(some_frame), Eq(std::ptrdiff_t(i)));
+        ASSERT_THAT(it2 - copy, Eq(std::ptrdiff_t(i)));
+    }
+}
+
+TEST(mismatch, stops_at_the_end_of_the_shorter_range)
+{
+    some_type array[] = {1, 4};
+
+    auto [it1, it2] = sut::mismatch(std::begin(some_array),
+                                    std::end(some_array),
+                                    std::begin(array), std::end(array));
+
+    ASSERT_THAT(it1, Eq(std::begin(some_array) + 2));
+    ASSERT_THAT(it2, Eq(std::end(array)));
+}
+
+TEST(equal, is_true_for_equal_ranges)
+{
+    some_type array[] = {1, 4, 3, 7, 9};
+
+    ASSERT_TRUE(sut::equal(std::begin(some_array), std::end(some_array),
+                           std::begin(array)));
+    ASSERT_TRUE(sut::equal(std::begin(some_array), std::end(some_array),
+                           std::begin(array), std::end(array)));
+}
+
+TEST(equal, is_false_for_ranges_of_different_lengths)
+{
+    ASSERT_FALSE(sut::equal(std::begin(some_array), std::end(some_array),
+                            std::begin(some_array), std::end(some_array) - 1));
+}
+
+TEST(equal, is_false_for_ranges_with_a_differing_element)
+{
+    some_type array[] = {1, 4, 3, 7, 8};
+
+    ASSERT_FALSE(sut::equal(std::begin(some_array), std::end(some_array),
+                            std::begin(array)));
+}
+
+TEST(equal, supports_input_iterators_and_predicates)
+{
+    auto [first1, last1] = make_range<input_iterator>(some_array);
+    auto [first2, last2] = make_range<input_iterator>(some_array);
+
+    ASSERT_TRUE(sut::equal(first1, last1, first2, last2,
+                           [](some_type a, some_type b) {return a == b;}));
+}
+
+TEST(search, returns_the_first_occurrence_of_the_sequence)
+{
+    byte delimiter[] = {0x7e, 0x7e};
+
+    auto it = sut::search(std::begin(some_frame), std::end(some_frame),
+                          std::begin(delimiter), std::end(delimiter));
+
+    ASSERT_THAT(it, Eq(std::begin(some_frame) + 6));
+}
+
+TEST(search, returns_first_for_an_empty_sequence)
+{
+    ASSERT_THAT(sut::search(std::begin(some_frame), std::end(some_frame),
+                            std::begin(some_frame), std::begin(some_frame)),
+                Eq(std::begin(some_frame)));
+}
+
+TEST(search, agrees_with_std_for_every_subsequence_of_bytes)
+{
+    for (auto s_first = std::begin(some_frame);
+         s_first != std::end(some_frame); ++s_first)
+    {
+        for (auto s_last = s_first; s_last - s_first <= 4 &&
+                                    s_last != std::end(some_frame); ++s_last)
+        {
+            byte pattern[4] = {};
+            std::copy(s_first, s_last, pattern);
+            auto p_last = pattern + (s_last - s_first);
+
+            ASSERT_THAT(sut::search(std::begin(some_frame),
+                                    std::end(some_frame), pattern, p_last),
+                        Eq(std::search(std::begin(some_frame),
+                                       std::end(some_frame), pattern,
+                                       p_last)));
+        }
+    }
+}
+
+TEST(search, returns_last_when_the_sequence_does_not_occur)
+{
+    some_type sequence[] = {3, 9};
+
+    ASSERT_THAT(sut::search(std::begin(some_array), std::end(some_array),
+                            std::begin(sequence), std::end(sequence)),
+                Eq(std::end(some_array)));
+}
+
+TEST(search, supports_forward_iterators)
+{
+    auto [first, last] = make_range<forward_iterator>(some_array);
+    some_type sequence[] = {3, 7};
+    auto [s_first, s_last] = make_range<forward_iterator>(sequence);
+
+    ASSERT_THAT(sut::search(first, last, s_first, s_last).base(),
+                Eq(std::begin(some_array) + 2));
+}
+
+TEST(search_n, returns_the_first_run_of_count_equal_elements)
+{
+    some_type array[] = {1, 2, 2, 3, 2, 2, 2};
+
+    ASSERT_THAT(sut::search_n(std::begin(array), std::end(array), 3, 2),
+                Eq(std::begin(array) + 4));
+    ASSERT_THAT(sut::search_n(std::begin(array), std::end(array), 4, 2),
+                Eq(std::end(array)));
+}
+
+TEST(search_n, returns_first_for_a_zero_count)
+{
+    ASSERT_THAT(sut::search_n(std::begin(some_array), std::end(some_array),
+                              0, 2),
+                Eq(std::begin(some_array)));
+}
+
+namespace
+{
+
+const char some_text[] = "the quick brown fox jumps over the lazy dog";
+
+template<class Searcher>
+std::ptrdiff_t find_in_text(const char* pattern)
+{
+    auto pattern_last = pattern + std::strlen(pattern);
+    auto searcher = Searcher(pattern, pattern_last);
+    auto text_last = some_text + std::strlen(some_text);
+
+    auto [first, last] = searcher(some_text, text_last);
+
+    if (first == text_last)
+        return -1;
+
+    EXPECT_THAT(last - first, Eq(pattern_last - pattern));
+    return first - some_text;
+}
+
+using char_default_searcher = sut::default_searcher<const char*>;
+using char_horspool_searcher = sut::boyer_moore_horspool_searcher<const char*>;
+using char_small_table_horspool_searcher =
+    sut::boyer_moore_horspool_searcher<const char*, 4>;
+
+}
+
+TEST(default_searcher, finds_the_first_occurrence_of_the_pattern)
+{
+    ASSERT_THAT(find_in_text<char_default_searcher>("the"), Eq(0));
+    ASSERT_THAT(find_in_text<char_default_searcher>("fox"), Eq(16));
+    ASSERT_THAT(find_in_text<char_default_searcher>("cat"), Eq(-1));
+}
+
+TEST(boyer_moore_horspool_searcher, finds_the_first_occurrence_of_the_pattern)
+{
+    ASSERT_THAT(find_in_text<char_horspool_searcher>("the"), Eq(0));
+    ASSERT_THAT(find_in_text<char_horspool_searcher>("lazy dog"), Eq(35));
+    ASSERT_THAT(find_in_text<char_horspool_searcher>("over the"), Eq(26));
+    ASSERT_THAT(find_in_text<char_horspool_searcher>("cat"), Eq(-1));
+}
+
+TEST(boyer_moore_horspool_searcher, finds_an_empty_pattern_at_the_start)
+{
+    ASSERT_THAT(find_in_text<char_horspool_searcher>(""), Eq(0));
+}
+
+TEST(boyer_moore_horspool_searcher, agrees_with_std_for_every_subsequence)
+{
+    for (auto s_first = std::begin(some_frame);
+         s_first != std::end(some_frame); ++s_first)
+    {
+        for (auto s_last = s_first; s_last != std::end(some_frame); ++s_last)
+        {
+            auto expected = std::search(std::begin(some_frame),
+                                        std::end(some_frame), s_first, s_last);
+
+            auto large = sut::boyer_moore_horspool_searcher(s_first, s_last);
+            auto small =
+                sut::boyer_moore_horspool_searcher<byte*, 2>(s_first, s_last);
+
+            ASSERT_THAT(sut::search(std::begin(some_frame),
+                                    std::end(some_frame), large),
+                        Eq(expected));
+            ASSERT_THAT(sut::search(std::begin(some_frame),
+                                    std::end(some_frame), small),
+                        Eq(expected));
+        }
+    }
+}
+
+TEST(boyer_moore_horspool_searcher, finds_patterns_longer_than_its_shifts)
+{
+    byte haystack[600] = {};
+    byte pattern[300];
+    sut::iota(std::begin(pattern), std::end(pattern), byte{0});
+    std::copy(std::begin(pattern), std::end(pattern), haystack + 250);
+
+    auto searcher = sut::boyer_moore_horspool_searcher(std::begin(pattern),
+                                                       std::end(pattern));
+
+    ASSERT_THAT(sut::search(std::begin(haystack), std::end(haystack),
+                            searcher),
+                Eq(haystack + 250));
+}
+
+TEST(boyer_moore_horspool_searcher, works_with_a_small_table)
+{
+    ASSERT_THAT(find_in_text<char_small_table_horspool_searcher>("lazy"),
+                Eq(35));
+}
+
+TEST(search, uses_the_given_searcher)
+{
+    some_type pattern[] = {3, 7};
+
+    auto it = sut::search(std::begin(some_array), std::end(some_array),
+                          sut::default_searcher(std::begin(pattern),
+                                                std::end(pattern)));
+
+    ASSERT_THAT(it, Eq(std::begin(some_array) + 2));
+}
+
+TEST(swap_ranges, swaps_the_elements_of_two_ranges)
+{
+    some_type array1[] = {1, 2, 3};
+    some_type array2[] = {4, 5, 6, 7};
+
+    auto end = sut::swap_ranges(std::begin(array1), std::end(array1),
+                                std::begin(array2));
+
+    ASSERT_THAT(end, Eq(std::begin(array2) + 3));
+    ASSERT_THAT(array1, ElementsAre(4, 5, 6));
+    ASSERT_THAT(array2, ElementsAre(1, 2, 3, 7));
+}
+
+TEST(replace, replaces_all_elements_equal_to_the_old_value)
+{
+    some_type array[] = {1, 2, 1, 3};
+
+    sut::replace(std::begin(array), std::end(array), 1, 9);
+
+    ASSERT_THAT(array, ElementsAre(9, 2, 9, 3));
+}
+
+TEST(replace_if, replaces_all_elements_satisfying_the_predicate)
+{
+    some_type array[] = {1, 2, 4, 3};
+
+    sut::replace_if(std::begin(array), std::end(array), is_even, 0);
+
+    ASSERT_THAT(array, ElementsAre(1, 0, 0, 3));
+}
+
+TEST(remove, moves_the_other_elements_to_the_front_in_order)
+{
+    some_type array[] = {1, 2, 1, 3, 1};
+
+    auto end = sut::remove(std::begin(array), std::end(array), 1);
+
+    ASSERT_THAT(end, Eq(std::begin(array) + 2));
+    ASSERT_THAT(array[0], Eq(2));
+    ASSERT_THAT(array[1], Eq(3));
+}
+
+TEST(remove_if, filters_a_vector_without_allocating)
+{
+    auto vec = sut::vector<some_type>{1, 2, 3, 4, 5, 6};
+    auto data = vec.data();
+
+    vec.erase(sut::remove_if(vec.begin(), vec.end(), is_even), vec.end());
+
+    ASSERT_THAT(vec.data(), Eq(data));
+    ASSERT_THAT(vec, ElementsAre(1, 3, 5));
+}
+
+TEST(remove_if, supports_forward_iterators)
+{
+    some_type array[] = {2, 1, 4, 3};
+    auto [first, last] = make_range<forward_iterator>(array);
+
+    auto end = sut::remove_if(first, last, is_even);
+
+    ASSERT_THAT(end.base(), Eq(std::begin(array) + 2));
+    ASSERT_THAT(array[0], Eq(1));
+    ASSERT_THAT(array[1], Eq(3));
+}
+
+TEST(unique, keeps_the_first_element_of_every_run)
+{
+    some_type array[] = {1, 1, 2, 2, 2, 3, 1, 1};
+
+    auto end = sut::unique(std::begin(array), std::end(array));
+
+    ASSERT_THAT(end, Eq(std::begin(array) + 4));
+    ASSERT_THAT(std::vector<some_type>(std::begin(array), end),
+                ElementsAre(1, 2, 3, 1));
+}
+
+TEST(unique, uses_the_given_predicate)
+{
+    some_type array[] = {1, 3, 2, 4, 5};
+
+    auto end = sut::unique(std::begin(array), std::end(array),
+                           [](some_type a, some_type b) {
+                               return a % 2 == b % 2;
+                           });
+
+    ASSERT_THAT(std::vector<some_type>(std::begin(array), end),
+                ElementsAre(1, 2, 5));
+}
+
+TEST(reverse, reverses_ranges_of_odd_and_even_sizes)
+{
+    some_type odd[] = {1, 2, 3};
+    some_type even[] = {1, 2, 3, 4};
+
+    sut::reverse(std::begin(odd), std::end(odd));
+    sut::reverse(std::begin(even), std::end(even));
+
+    ASSERT_THAT(odd, ElementsAre(3, 2, 1));
+    ASSERT_THAT(even, ElementsAre(4, 3, 2, 1));
+}
+
+template<template<typename> class Iterator>
+void check_rotate()
+{
+    for (std::size_t size = 0; size <= 12; ++size)
+    {
+        for (std::size_t shift = 0; shift <= size; ++shift)
+        {
+            some_type array[12];
+            std::iota(array, array + size, 0);
+            auto first = Iterator<some_type>(array);
+            auto last = Iterator<some_type>(array + size);
+
+            auto result = sut::rotate(first, Iterator<some_type>(array + shift),
+                                      last);
+
+            ASSERT_THAT(result.base(), Eq(array + (size - shift)));
+            for (std::size_t i = 0; i < size; ++i)
+                ASSERT_THAT(array[i], Eq(some_type((i + shift) % size)));
+        }
+    }
+}
+
+TEST(rotate, rotates_random_access_ranges_of_every_size_and_shift)
+{
+    check_rotate<random_access_iterator>();
+}
+
+TEST(rotate, rotates_forward_ranges_of_every_size_and_shift)
+{
+    check_rotate<forward_iterator>();
+}
+
+TEST(partition, moves_the_elements_satisfying_the_predicate_to_the_front)
+{
+    auto values = random_values(100, 1000);
+
+    auto split = sut::partition(values.data(), values.data() + values.size(),
+                                is_even);
+
+    ASSERT_TRUE(std::all_of(values.data(), split, is_even));
+    ASSERT_TRUE(std::none_of(split, values.data() + values.size(), is_even));
+}
+
+TEST(partition, supports_forward_iterators)
+{
+    some_type array[] = {1, 2, 3, 4, 5, 6};
+    auto [first, last] = make_range<forward_iterator>(array);
+
+    auto split = sut::partition(first, last, is_even);
+
+    ASSERT_THAT(split.base(), Eq(std::begin(array) + 3));
+    ASSERT_TRUE(std::is_partitioned(std::begin(array), std::end(array),
+                                    is_even));
+}
+
+TEST(is_partitioned, is_true_when_no_matching_element_follows_a_mismatch)
+{
+    some_type partitioned[] = {2, 4, 1, 3};
+
+    ASSERT_TRUE(sut::is_partitioned(std::begin(partitioned),
+                                    std::end(partitioned), is_even));
+    ASSERT_FALSE(sut::is_partitioned(std::begin(some_array),
+                                     std::end(some_array), is_even));
+}
+
+TEST(stable_partition, keeps_the_order_of_both_parts)
+{
+    for (auto n : {0u, 1u, 2u, 7u, 100u})
+    {
+        auto values = random_values(n, 1000);
+        auto expected = values;
+        std::stable_partition(expected.begin(), expected.end(), is_even);
+
+        auto split = sut::stable_partition(values.data(),
+                                           values.data() + values.size(),
+                                           is_even);
+
+        ASSERT_THAT(values, ElementsAreArray(expected));
+        ASSERT_THAT(split - values.data(),
+                    Eq(std::count_if(values.begin(), values.end(), is_even)));
+    }
+}
+
+TEST(stable_partition, supports_forward_iterators)
+{
+    some_type array[] = {1, 2, 3, 4, 5, 6};
+    auto [first, last] = make_range<forward_iterator>(array);
+
+    sut::stable_partition(first, last, is_even);
+
+    ASSERT_THAT(array, ElementsAre(2, 4, 6, 1, 3, 5));
+}
+
+TEST(partition_point, returns_the_end_of_the_first_part)
+{
+    some_type partitioned[] = {2, 4, 6, 1, 3};
+
+    ASSERT_THAT(sut::partition_point(std::begin(partitioned),
+                                     std::end(partitioned), is_even),
+                Eq(std::begin(partitioned) + 3));
+}
+
+TEST(merge, merges_two_sorted_ranges)
+{
+    some_type array1[] = {1, 3, 5, 7, 8};
+    some_type array2[] = {2, 3, 4};
+    some_type result[8] = {};
+
+    auto end = sut::merge(std::begin(array1), std::end(array1),
+                          std::begin(array2), std::end(array2),
+                          std::begin(result));
+
+    ASSERT_THAT(end, Eq(std::end(result)));
+    ASSERT_THAT(result, ElementsAre(1, 2, 3, 3, 4, 5, 7, 8));
+}
+
+TEST(merge, takes_equivalent_elements_from_the_first_range_first)
+{
+    keyed array1[] = {{1, 0}, {2, 1}};
+    keyed array2[] = {{1, 2}, {2, 3}};
+    keyed result[4] = {};
+
+    sut::merge(std::begin(array1), std::end(array1), std::begin(array2),
+               std::end(array2), std::begin(result), key_less);
+
+    for (std::size_t i = 0; i < 4; ++i)
+        ASSERT_THAT(result[i].index, Eq(i < 2 ? i * 2 : (i - 2) * 2 + 1));
+}
+
+namespace
+{
+
+// Two sorted halves of keyed elements, indexed in their original order.
+std::vector<keyed> sorted_halves(std::size_t size1, std::size_t size2)
+{
+    auto keys1 = random_values(size1, 10);
+    auto keys2 = random_values(size2 + size1, 10);
+    std::sort(keys1.begin(), keys1.end());
+    std::sort(keys2.begin() + size1, keys2.end());
+
+    auto values = std::vector<keyed>();
+    for (std::size_t i = 0; i < size1; ++i)
+        values.push_back({keys1[i], i});
+    for (std::size_t i = size1; i < size1 + size2; ++i)
+        values.push_back({keys2[i], i});
+
+    return values;
+}
+
+void expect_stably_sorted(const std::vector<keyed>& values)
+{
+    for (std::size_t i = 1; i < values.size(); ++i)
+    {
+        ASSERT_THAT(values[i - 1].key, Le(values[i].key));
+
+        if (values[i - 1].key == values[i].key)
+        {
+            ASSERT_THAT(values[i - 1].index, Lt(values[i].index));
+        }
+    }
+}
+
+}
+
+TEST(inplace_merge, merges_stably_without_a_buffer)
+{
+    for (std::size_t size1 : {0u, 1u, 2u, 17u, 100u})
+    {
+        for (std::size_t size2 : {0u, 1u, 3u, 50u})
+        {
+            auto values = sorted_halves(size1, size2);
+
+            sut::inplace_merge(values.data(), values.data() + size1,
+                               values.data() + values.size(), key_less);
+
+            expect_stably_sorted(values);
+        }
+    }
+}
+
+TEST(inplace_merge, merges_stably_with_buffers_of_any_size)
+{
+    for (std::size_t buffer_size : {0u, 1u, 7u, 40u, 100u})
+    {
+        for (std::size_t size1 : {1u, 30u, 100u})
+        {
+            auto values = sorted_halves(size1, 130 - size1);
+            auto buffer = std::vector<keyed>(buffer_size);
+
+            sut::inplace_merge(values.data(), values.data() + size1,
+                               values.data() + values.size(), buffer.data(),
+                               buffer.data() + buffer.size(), key_less);
+
+            expect_stably_sorted(values);
+        }
+    }
+}
+
+TEST(inplace_merge, supports_bidirectional_iterators)
+{
+    some_type array[] = {2, 4, 6, 8, 1, 3, 5, 7, 9};
+    auto [first, last] = make_range<bidirectional_iterator>(array);
+    auto middle = bidirectional_iterator<some_type>(array + 4);
+    some_type buffer[2];
+
+    sut::inplace_merge(first, middle, last);
+    ASSERT_THAT(array, ElementsAre(1, 2, 3, 4, 5, 6, 7, 8, 9));
+
+    std::rotate(array, array + 4, array + 9);
+    sut::inplace_merge(first, bidirectional_iterator<some_type>(array + 5),
+                       last, std::begin(buffer), std::end(buffer));
+    ASSERT_THAT(array, ElementsAre(1, 2, 3, 4, 5, 6, 7, 8, 9));
+}
+
+TEST(includes, is_true_if_every_element_of_the_second_range_is_found)
+{
+    some_type array[] = {1, 2, 2, 4, 7};
+    some_type subset[] = {2, 2, 7};
+    some_type other[] = {2, 2, 2};
+
+    ASSERT_TRUE(sut::includes(std::begin(array), std::end(array),
+                              std::begin(subset), std::end(subset)));
+    ASSERT_FALSE(sut::includes(std::begin(array), std::end(array),
+                               std::begin(other), std::end(other)));
+    ASSERT_TRUE(sut::includes(std::begin(array), std::end(array),
+                              std::begin(other), std::begin(other)));
+}
+
+namespace
+{
+
+some_type set1[] = {1, 2, 2, 2, 4, 6, 9};
+some_type set2[] = {2, 2, 3, 4, 4, 9, 10};
+
+}
+
+TEST(set_union, keeps_the_maximum_count_of_every_element)
+{
+    some_type result[16] = {};
+
+    auto end = sut::set_union(std::begin(set1), std::end(set1),
+                              std::begin(set2), std::end(set2),
+                              std::begin(result));
+
+    ASSERT_THAT(std::vector<some_type>(std::begin(result), end),
+                ElementsAre(1, 2, 2, 2, 3, 4, 4, 6, 9, 10));
+}
+
+TEST(set_intersection, keeps_the_minimum_count_of_every_element)
+{
+    some_type result[16] = {};
+
+    auto end = sut::set_intersection(std::begin(set1), std::end(set1),
+                                     std::begin(set2), std::end(set2),
+                                     std::begin(result));
+
+    ASSERT_THAT(std::vector<some_type>(std::begin(result), end),
+                ElementsAre(2, 2, 4, 9));
+}
+
+TEST(set_difference, keeps_the_elements_missing_from_the_second_range)
+{
+    some_type result[16] = {};
+
+    auto end = sut::set_difference(std::begin(set1), std::end(set1),
+                                   std::begin(set2), std::end(set2),
+                                   std::begin(result));
+
+    ASSERT_THAT(std::vector<some_type>(std::begin(result), end),
+                ElementsAre(1, 2, 6));
+}
+
+TEST(set_symmetric_difference, keeps_the_elements_missing_from_either_range)
+{
+    some_type result[16] = {};
+
+    auto end = sut::set_symmetric_difference(std::begin(set1), std::end(set1),
+                                             std::begin(set2), std::end(set2),
+                                             std::begin(result));
+
+    ASSERT_THAT(std::vector<some_type>(std::begin(result), end),
+                ElementsAre(1, 2, 3, 4, 6, 10));
+}
+
+TEST(set_intersection, uses_the_given_comparison)
+{
+    some_type array1[] = {9, 6, 4, 2};
+    some_type array2[] = {8, 6, 2, 1};
+    some_type result[4] = {};
+
+    auto end = sut::set_intersection(std::begin(array1), std::end(array1),
+                                     std::begin(array2), std::end(array2),
+                                     std::begin(result), greater{});
+
+    ASSERT_THAT(std::vector<some_type>(std::begin(result), end),
+                ElementsAre(6, 2));
+}
+
+TEST(copy, copies_between_contiguous_iterators)
+{
+    some_type source[] = {1, 2, 3};
+    some_type destination[3] = {};
+    auto [first, last] = make_range<contiguous_iterator>(source);
+
+    auto end = sut::copy(first, last,
+                         contiguous_iterator<some_type>(destination));
+
+    ASSERT_THAT(end.base(), Eq(std::end(destination)));
+    ASSERT_THAT(destination, ElementsAre(1, 2, 3));
+}
+
+TEST(fill, fills_byte_ranges_behind_contiguous_iterators)
+{
+    char array[5] = {};
+    auto [first, last] = make_range<contiguous_iterator>(array);
+
+    sut::fill(first + 1, last, 'x');
+
+    ASSERT_THAT(array, ElementsAre('\0', 'x', 'x', 'x', 'x'));
+}
+
+TEST(find, finds_bytes_behind_contiguous_iterators)
+{
+    unsigned char array[] = {1, 2, 3, 2};
+    auto [first, last] = make_range<contiguous_iterator>(array);
+
+    ASSERT_THAT(sut::find(first, last, 2).base(), Eq(array + 1));
+    ASSERT_THAT(sut::find(first, last, 5), Eq(last));
+    ASSERT_THAT(sut::count(first, last, 2), Eq(2));
+}
+
+TEST(equal, compares_contiguous_iterators)
+{
+    some_type array1[] = {1, 2, 3};
+    some_type array2[] = {1, 2, 4};
+    auto [first1, last1] = make_range<contiguous_iterator>(array1);
+    auto [first2, last2] = make_range<contiguous_iterator>(array2);
+
+    ASSERT_TRUE(sut::equal(first1, last1 - 1, first2));
+    ASSERT_FALSE(sut::equal(first1, last1, first2, last2));
+}
@@ -0,0 +1,33 @@
+#include "gmock/gmock.h"
+
+#include "sut/bit"
+#include "sut/cstdint"
+
+using namespace testing;
+
+TEST(popcount, returns_zero_for_zero)
+{
+    static_assert(sut::popcount(0u) == 0);
+}
+
+TEST(popcount, counts_the_set_bits_of_all_unsigned_widths)
+{
+    static_assert(sut::popcount(sut::uint8_t(0xa5)) == 4);
+    static_assert(sut::popcount(sut::uint16_t(0xffff)) == 16);
+    static_assert(sut::popcount(sut::uint32_t(0x80000001)) == 2);
+    static_assert(sut::popcount(sut::uint64_t(0xf00000000000000f)) == 8);
+}
+
+TEST(countr_zero, returns_the_bit_width_for_zero)
+{
+    static_assert(sut::countr_zero(sut::uint8_t(0)) == 8);
+    static_assert(sut::countr_zero(sut::uint64_t(0)) == 64);
+}
+
+TEST(countr_zero, counts_the_trailing_zero_bits_of_all_unsigned_widths)
+{
+    static_assert(sut::countr_zero(sut::uint8_t(0x80)) == 7);
+    static_assert(sut::countr_zero(sut::uint16_t(0x0100)) == 8);
+    static_assert(sut::countr_zero(sut::uint32_t(0x80000000)) == 31);
+    static_assert(sut::countr_zero(sut::uint64_t(1) << 40) == 40);
+}
@@ -0,0 +1,64 @@
+#include "gmock/gmock.h"
+
+#include "sut/functional"
+
+using namespace testing;
+
+namespace
+{
+
+struct some_type
+{
+    int value;
+};
+
+bool operator<(some_type lhs, some_type rhs) {return lhs.value < rhs.value;}
+bool operator>(some_type lhs, some_type rhs) {return lhs.value > rhs.value;}
+bool operator==(some_type lhs, some_type rhs) {return lhs.value == rhs.value;}
+
+}
+
+TEST(less, compares_with_less_than)
+{
+    static_assert(sut::less<int>()(1, 2));
+    static_assert(!sut::less<int>()(2, 2));
+    ASSERT_TRUE(sut::less<some_type>()({1}, {2}));
+}
+
+TEST(less, compares_values_of_different_types_when_transparent)
+{
+    static_assert(sut::less<>()(1, 2.5));
+    static_assert(!sut::less<>()(3.5, 2));
+}
+
+TEST(greater, compares_with_greater_than)
+{
+    static_assert(sut::greater<int>()(2, 1));
+    static_assert(!sut::greater<int>()(2, 2));
+    ASSERT_TRUE(sut::greater<>()(some_type{2}, some_type{1}));
+}
+
+TEST(equal_to, compares_with_equality)
+{
+    static_assert(sut::equal_to<int>()(2, 2));
+    static_assert(!sut::equal_to<>()(2, 3));
+    ASSERT_TRUE(sut::equal_to<some_type>()({1}, {1}));
+}
+
+TEST(plus, adds_its_arguments)
+{
+    static_assert(sut::plus<int>()(2, 3) == 5);
+    static_assert(sut::plus<>()(2, 0.5) == 2.5);
+}
+
+TEST(minus, subtracts_its_arguments)
+{
+    static_assert(sut::minus<int>()(2, 3) == -1);
+    static_assert(sut::minus<>()(2, 0.5) == 1.5);
+}
+
+TEST(multiplies, multiplies_its_arguments)
+{
+    static_assert(sut::multiplies<int>()(2, 3) == 6);
+    static_assert(sut::multiplies<>()(2, 0.5) == 1.0);
+}
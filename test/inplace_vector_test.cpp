@@ -0,0 +1,205 @@
+#include "gmock/gmock.h"
+
+#include "sut/inplace_vector"
+
+#include <type_traits>
+
+using namespace testing;
+
+namespace
+{
+
+using some_type = int;
+
+const sut::size_t some_capacity = 8;
+const sut::size_t some_size = 5;
+const some_type some_value = 42;
+auto some_initializer_list = {2, 5, 1, 7, 5};
+using some_inplace_vector = sut::inplace_vector<some_type, some_capacity>;
+auto some_vec1 = some_inplace_vector{2, 4, 3, 8};
+auto some_vec2 = some_inplace_vector{4, 2, 5, 6, 9, 0};
+
+struct instance_counter
+{
+    static inline int instances = 0;
+
+    instance_counter() {++instances;}
+    instance_counter(const instance_counter&) {++instances;}
+    ~instance_counter() {--instances;}
+};
+
+}
+
+TEST(an_inplace_vector, has_size_zero_when_default_constructed)
+{
+    auto vec = some_inplace_vector();
+
+    ASSERT_THAT(vec.size(), Eq(0u));
+    ASSERT_TRUE(vec.empty());
+}
+
+TEST(an_inplace_vector, has_its_template_argument_as_capacity)
+{
+    static_assert(some_inplace_vector::capacity() == some_capacity);
+}
+
+TEST(an_inplace_vector, stores_its_elements_inside_the_object)
+{
+    auto vec = some_inplace_vector(some_size, some_value);
+    auto vec_begin = reinterpret_cast<const char*>(&vec);
+    auto vec_end = vec_begin + sizeof(vec);
+    auto data = reinterpret_cast<const char*>(vec.data());
+
+    ASSERT_THAT(data, Ge(vec_begin));
+    ASSERT_THAT(data + some_capacity * sizeof(some_type), Le(vec_end));
+}
+
+TEST(an_inplace_vector, uses_a_single_byte_size_field_for_small_capacities)
+{
+    static_assert(sizeof(sut::inplace_vector<char, 16>) == 17);
+}
+
+TEST(an_inplace_vector, uses_a_two_byte_size_field_for_medium_capacities)
+{
+    static_assert(sizeof(sut::inplace_vector<char, 256>) == 258);
+}
+
+TEST(an_inplace_vector, is_trivially_copyable_when_its_element_type_is)
+{
+    static_assert(std::is_trivially_copyable_v<some_inplace_vector>);
+}
+
+TEST(an_inplace_vector, is_not_trivially_copyable_when_its_element_type_is_not)
+{
+    using vec_type = sut::inplace_vector<instance_counter, some_capacity>;
+
+    static_assert(!std::is_trivially_copyable_v<vec_type>);
+}
+
+TEST(an_inplace_vector, contains_count_elements_equal_to_the_given_value)
+{
+    auto vec = some_inplace_vector(3, some_value);
+
+    ASSERT_THAT(vec, ElementsAreArray({some_value, some_value, some_value}));
+}
+
+TEST(an_inplace_vector, contains_count_default_constructed_elements_when_no_value_given)
+{
+    auto vec = some_inplace_vector(3);
+
+    ASSERT_THAT(vec, ElementsAreArray({some_type{}, some_type{}, some_type{}}));
+}
+
+TEST(an_inplace_vector, contains_the_element_from_the_given_initializer_list)
+{
+    auto vec = some_inplace_vector(some_initializer_list);
+
+    ASSERT_THAT(vec, ElementsAreArray(some_initializer_list));
+}
+
+TEST(an_inplace_vector, contains_the_elements_from_the_given_iterator_range)
+{
+    auto vec = some_inplace_vector(some_vec1.begin(), some_vec1.end());
+
+    ASSERT_THAT(vec, ElementsAreArray(some_vec1));
+}
+
+TEST(an_inplace_vector, has_the_same_elements_as_the_source_vector_it_was_copied_from)
+{
+    auto source_vec = some_inplace_vector(some_size, some_value);
+
+    auto vec = source_vec;
+
+    ASSERT_THAT(vec, ElementsAreArray(source_vec));
+}
+
+TEST(an_inplace_vector, has_the_same_elements_as_the_source_vector_it_was_assigned_from)
+{
+    auto source_vec = some_vec2;
+
+    auto vec = some_vec1;
+    vec = source_vec;
+
+    ASSERT_THAT(vec, ElementsAreArray(some_vec2));
+}
+
+TEST(an_inplace_vector, has_the_same_elements_as_the_source_initializer_list_it_was_assigned_from)
+{
+    auto vec = some_vec1;
+
+    vec = some_initializer_list;
+
+    ASSERT_THAT(vec, ElementsAreArray(some_initializer_list));
+}
+
+TEST(an_inplace_vector, has_the_same_elements_as_the_other_vector_after_swap)
+{
+    auto vec1 = some_vec1;
+    auto vec2 = some_vec2;
+
+    sut::swap(vec1, vec2);
+
+    ASSERT_THAT(vec1, ElementsAreArray(some_vec2));
+    ASSERT_THAT(vec2, ElementsAreArray(some_vec1));
+}
+
+TEST(an_inplace_vector, contains_the_pushed_back_elements_in_order)
+{
+    auto vec = some_inplace_vector();
+
+    for (auto value : some_initializer_list)
+        vec.push_back(value);
+
+    ASSERT_THAT(vec, ElementsAreArray(some_initializer_list));
+}
+
+TEST(an_inplace_vector, returns_a_reference_to_the_new_element_for_emplace_back)
+{
+    auto vec = some_inplace_vector();
+
+    auto& element = vec.emplace_back(some_value);
+
+    ASSERT_THAT(&element, Eq(&vec.back()));
+    ASSERT_THAT(element, Eq(some_value));
+}
+
+TEST(an_inplace_vector, removes_the_last_element_for_pop_back)
+{
+    auto vec = some_vec1;
+
+    vec.pop_back();
+
+    ASSERT_THAT(vec, ElementsAreArray(some_vec1.begin(), some_vec1.end() - 1));
+}
+
+TEST(an_inplace_vector, returns_first_and_last_element_for_front_and_back)
+{
+    ASSERT_THAT(some_vec1.front(), Eq(*some_vec1.begin()));
+    ASSERT_THAT(some_vec1.back(), Eq(*(some_vec1.end() - 1)));
+}
+
+TEST(an_inplace_vector, returns_the_element_at_the_given_index_for_array_access_and_at)
+{
+    ASSERT_THAT(some_vec1[2], Eq(*(some_vec1.begin() + 2)));
+    ASSERT_THAT(some_vec1.at(2), Eq(*(some_vec1.begin() + 2)));
+}
+
+TEST(an_inplace_vector, destroys_its_elements)
+{
+    instance_counter::instances = 0;
+
+    {
+        auto vec = sut::inplace_vector<instance_counter, some_capacity>(3);
+        auto copy = vec;
+        copy.pop_back();
+    }
+
+    ASSERT_THAT(instance_counter::instances, Eq(0));
+}
+
+TEST(an_inplace_vector_death_test, aborts_when_pushing_back_beyond_its_capacity)
+{
+    auto vec = sut::inplace_vector<some_type, 1>{some_value};
+
+    ASSERT_DEATH(vec.push_back(some_value), "");
+}
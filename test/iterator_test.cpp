@@ -2,7 +2,11 @@
 
 #include "sut/iterator"
 
+#include "test_iterators.hpp"
+
 #include <iterator>
+#include <deque>
+#include <vector>
 
 using namespace testing;
 
@@ -119,6 +123,8 @@ TEST(iterator_traits, supports_pointers)
     StaticAssertTypeEq<traits::reference, some_type&>();
     StaticAssertTypeEq<traits::iterator_category,
                        sut::random_access_iterator_tag>();
+    StaticAssertTypeEq<traits::iterator_concept,
+                       sut::contiguous_iterator_tag>();
 }
 
 TEST(iterator_traits, supports_const_pointers)
@@ -131,6 +137,8 @@ TEST(iterator_traits, supports_const_pointers)
     StaticAssertTypeEq<traits::reference, const some_type&>();
     StaticAssertTypeEq<traits::iterator_category,
     sut::random_access_iterator_tag>();
+    StaticAssertTypeEq<traits::iterator_concept,
+                       sut::contiguous_iterator_tag>();
 }
 
 TEST(iterator_traits, supports_iterators)
@@ -186,3 +194,263 @@ TEST(require_x_iterator, supports_sfinae)
     // a better match for the second one.
     static_assert(require_x_iterator_test<some_output_iterator>(0l));
 }
+
+TEST(is_bitwise_copyable, is_true_for_pointers_to_the_same_trivially_copyable_type)
+{
+    static_assert(sut::detail::is_bitwise_copyable_v<const int*, int*>);
+    static_assert(sut::detail::is_bitwise_copyable_v<int*, int*>);
+}
+
+TEST(is_bitwise_copyable, is_false_for_pointers_to_different_types)
+{
+    static_assert(!sut::detail::is_bitwise_copyable_v<const int*, long*>);
+}
+
+TEST(is_bitwise_copyable, is_false_for_non_pointer_iterators)
+{
+    static_assert(!sut::detail::is_bitwise_copyable_v<some_iterator, int*>);
+}
+
+TEST(is_bitwise_copyable, is_true_for_contiguous_iterators)
+{
+    static_assert(sut::detail::is_bitwise_copyable_v<
+        contiguous_iterator<const int>, int*>);
+    static_assert(sut::detail::is_bitwise_copyable_v<
+        int*, contiguous_iterator<int>>);
+    static_assert(!sut::detail::is_bitwise_copyable_v<
+        int*, contiguous_iterator<const int>>);
+    static_assert(!sut::detail::is_bitwise_copyable_v<
+        random_access_iterator<int>, int*>);
+}
+
+TEST(contiguous_iterator_tag, refines_random_access_iterator_tag)
+{
+    static_assert(std::is_base_of_v<sut::random_access_iterator_tag,
+                                    sut::contiguous_iterator_tag>);
+    static_assert(sut::detail::is_random_access_iterator_v<
+        contiguous_iterator<int>>);
+}
+
+TEST(is_contiguous_iterator, is_true_for_pointers)
+{
+    static_assert(sut::detail::is_contiguous_iterator_v<int*>);
+    static_assert(sut::detail::is_contiguous_iterator_v<const int*>);
+}
+
+TEST(is_contiguous_iterator, is_true_for_iterators_with_a_contiguous_concept)
+{
+    static_assert(sut::detail::is_contiguous_iterator_v<
+        contiguous_iterator<int>>);
+}
+
+TEST(is_contiguous_iterator, is_false_for_other_iterators)
+{
+    static_assert(!sut::detail::is_contiguous_iterator_v<
+        random_access_iterator<int>>);
+    static_assert(!sut::detail::is_contiguous_iterator_v<some_iterator>);
+    static_assert(!sut::detail::is_contiguous_iterator_v<int>);
+}
+
+namespace
+{
+
+some_type some_array[] = {3, 1, 4, 1, 5};
+constexpr some_type some_array_constant[] = {3, 1, 4, 1, 5};
+
+}
+
+TEST(distance, returns_the_number_of_steps_between_input_iterators)
+{
+    auto [first, last] = make_range<input_iterator>(some_array);
+
+    ASSERT_THAT(sut::distance(first, last), Eq(5));
+}
+
+TEST(distance, returns_the_difference_between_random_access_iterators)
+{
+    auto [first, last] = make_range<random_access_iterator>(some_array);
+
+    ASSERT_THAT(sut::distance(first, last), Eq(5));
+    ASSERT_THAT(sut::distance(last, first), Eq(-5));
+}
+
+TEST(distance, supports_pointers)
+{
+    ASSERT_THAT(sut::distance(std::begin(some_array), std::end(some_array)),
+                Eq(5));
+}
+
+TEST(advance, steps_input_iterators_forwards)
+{
+    auto [first, last] = make_range<input_iterator>(some_array);
+
+    sut::advance(first, 3);
+
+    ASSERT_THAT(*first, Eq(1));
+}
+
+TEST(advance, steps_bidirectional_iterators_backwards)
+{
+    auto [first, last] = make_range<bidirectional_iterator>(some_array);
+
+    sut::advance(last, -2);
+
+    ASSERT_THAT(*last, Eq(1));
+}
+
+TEST(advance, jumps_random_access_iterators_in_both_directions)
+{
+    auto [first, last] = make_range<random_access_iterator>(some_array);
+
+    sut::advance(first, 4);
+    sut::advance(last, -5);
+
+    ASSERT_THAT(*first, Eq(5));
+    ASSERT_THAT(*last, Eq(3));
+}
+
+TEST(advance, is_usable_in_constant_expressions)
+{
+    constexpr auto pointer = [] {
+        const some_type* it = some_array_constant;
+        sut::advance(it, 2);
+        return it;
+    }();
+
+    static_assert(*pointer == 4);
+}
+
+TEST(next, returns_the_iterator_the_given_number_of_steps_ahead)
+{
+    auto [first, last] = make_range<forward_iterator>(some_array);
+
+    ASSERT_THAT(*sut::next(first), Eq(1));
+    ASSERT_THAT(*sut::next(first, 4), Eq(5));
+    ASSERT_THAT(sut::next(first, 5), Eq(last));
+}
+
+TEST(prev, returns_the_iterator_the_given_number_of_steps_back)
+{
+    auto [first, last] = make_range<bidirectional_iterator>(some_array);
+
+    ASSERT_THAT(*sut::prev(last), Eq(5));
+    ASSERT_THAT(sut::prev(last, 5), Eq(first));
+    ASSERT_THAT(*sut::prev(std::end(some_array), 3), Eq(4));
+}
+
+TEST(reverse_iterator, traverses_the_range_backwards)
+{
+    auto first = sut::make_reverse_iterator(std::end(some_array));
+    auto last = sut::make_reverse_iterator(std::begin(some_array));
+
+    auto values = std::vector<some_type>();
+    for (; first != last; ++first)
+        values.push_back(*first);
+
+    ASSERT_THAT(values, ElementsAre(5, 1, 4, 1, 3));
+}
+
+TEST(reverse_iterator, supports_random_access)
+{
+    auto first = sut::make_reverse_iterator(std::end(some_array));
+    auto last = sut::make_reverse_iterator(std::begin(some_array));
+
+    ASSERT_THAT(last - first, Eq(5));
+    ASSERT_THAT(first[2], Eq(4));
+    ASSERT_THAT(*(first + 3), Eq(1));
+    ASSERT_THAT((last - 1).base(), Eq(std::begin(some_array) + 1));
+    ASSERT_TRUE(first < last);
+    static_assert(std::is_same_v<
+        sut::iterator_traits<decltype(first)>::iterator_category,
+        sut::random_access_iterator_tag>);
+}
+
+TEST(reverse_iterator, is_not_contiguous)
+{
+    static_assert(!sut::detail::is_contiguous_iterator_v<
+        sut::reverse_iterator<some_type*>>);
+}
+
+TEST(reverse_iterator, keeps_the_category_of_bidirectional_iterators)
+{
+    auto [first, last] = make_range<bidirectional_iterator>(some_array);
+    auto it = sut::make_reverse_iterator(last);
+
+    static_assert(std::is_same_v<
+        sut::iterator_traits<decltype(it)>::iterator_category,
+        sut::bidirectional_iterator_tag>);
+    ASSERT_THAT(*++it, Eq(1));
+    ASSERT_THAT(*--it, Eq(5));
+    ASSERT_TRUE(sut::make_reverse_iterator(first) != it);
+}
+
+TEST(move_iterator, yields_rvalue_references)
+{
+    auto it = sut::make_move_iterator(std::begin(some_array));
+
+    static_assert(std::is_same_v<decltype(*it), some_type&&>);
+    ASSERT_THAT(it.operator->(), Eq(std::begin(some_array)));
+}
+
+TEST(move_iterator, moves_the_elements_out_of_the_range)
+{
+    std::vector<some_type> sources[] = {{1, 2}, {3}};
+    auto first = sut::make_move_iterator(std::begin(sources));
+    auto last = sut::make_move_iterator(std::end(sources));
+
+    ASSERT_THAT(last - first, Eq(2));
+
+    auto destination = std::vector<std::vector<some_type>>();
+    for (; first != last; ++first)
+        destination.push_back(*first);
+
+    ASSERT_THAT(destination, ElementsAre(ElementsAre(1, 2), ElementsAre(3)));
+    ASSERT_THAT(sources[0], IsEmpty());
+}
+
+TEST(move_iterator, keeps_the_category_and_concept_of_the_underlying_iterator)
+{
+    using iterator = sut::move_iterator<some_type*>;
+
+    static_assert(std::is_same_v<
+        sut::iterator_traits<iterator>::iterator_category,
+        sut::random_access_iterator_tag>);
+    static_assert(sut::detail::is_contiguous_iterator_v<iterator>);
+    static_assert(sut::detail::is_bitwise_copyable_v<iterator, some_type*>);
+    static_assert(!sut::detail::is_contiguous_iterator_v<
+        sut::move_iterator<random_access_iterator<some_type>>>);
+}
+
+TEST(back_insert_iterator, appends_the_assigned_values)
+{
+    auto container = std::vector<some_type>{1};
+    auto it = sut::back_inserter(container);
+
+    *it++ = 2;
+    *++it = 3;
+
+    ASSERT_THAT(container, ElementsAre(1, 2, 3));
+    static_assert(sut::detail::is_output_iterator_v<decltype(it)>);
+}
+
+TEST(front_insert_iterator, prepends_the_assigned_values)
+{
+    auto container = std::deque<some_type>{1};
+    auto it = sut::front_inserter(container);
+
+    *it++ = 2;
+    *it++ = 3;
+
+    ASSERT_THAT(container, ElementsAre(3, 2, 1));
+}
+
+TEST(insert_iterator, inserts_the_assigned_values_in_order)
+{
+    auto container = std::vector<some_type>{1, 4};
+    auto it = sut::inserter(container, container.begin() + 1);
+
+    *it++ = 2;
+    *it++ = 3;
+
+    ASSERT_THAT(container, ElementsAre(1, 2, 3, 4));
+}
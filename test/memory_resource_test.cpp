@@ -0,0 +1,112 @@
+#include "gmock/gmock.h"
+
+#include "sut/memory_resource"
+
+using namespace testing;
+
+namespace
+{
+
+const sut::size_t some_buffer_size = 64;
+const sut::size_t some_bytes = 5;
+const sut::size_t some_alignment = 8;
+
+struct monotonic_buffer_resource : Test
+{
+    alignas(some_alignment) unsigned char buffer[some_buffer_size];
+    sut::monotonic_buffer_resource resource{buffer};
+};
+
+struct arena_allocator : monotonic_buffer_resource
+{
+    sut::arena_allocator<int> allocator{resource};
+};
+
+}
+
+TEST_F(monotonic_buffer_resource, allocates_from_the_start_of_the_buffer)
+{
+    auto p = resource.allocate(some_bytes, 1);
+
+    ASSERT_THAT(p, Eq(buffer));
+    ASSERT_THAT(resource.remaining(), Eq(some_buffer_size - some_bytes));
+}
+
+TEST_F(monotonic_buffer_resource, allocates_consecutive_blocks)
+{
+    auto p1 = resource.allocate(some_bytes, 1);
+    auto p2 = resource.allocate(some_bytes, 1);
+
+    ASSERT_THAT(p2, Eq(static_cast<unsigned char*>(p1) + some_bytes));
+}
+
+TEST_F(monotonic_buffer_resource, aligns_allocations)
+{
+    resource.allocate(some_bytes, 1);
+
+    auto p = resource.allocate(some_bytes, some_alignment);
+
+    ASSERT_THAT(reinterpret_cast<sut::uintptr_t>(p) % some_alignment, Eq(0u));
+}
+
+TEST_F(monotonic_buffer_resource, does_not_reuse_deallocated_memory)
+{
+    auto p1 = resource.allocate(some_bytes, 1);
+    resource.deallocate(p1, some_bytes, 1);
+
+    auto p2 = resource.allocate(some_bytes, 1);
+
+    ASSERT_THAT(p2, Ne(p1));
+}
+
+TEST_F(monotonic_buffer_resource, makes_the_whole_buffer_available_after_release)
+{
+    resource.allocate(some_bytes, 1);
+
+    resource.release();
+
+    ASSERT_THAT(resource.remaining(), Eq(some_buffer_size));
+    ASSERT_THAT(resource.allocate(some_bytes, 1), Eq(buffer));
+}
+
+TEST_F(monotonic_buffer_resource, can_hand_out_the_whole_buffer)
+{
+    auto p = resource.allocate(some_buffer_size, 1);
+
+    ASSERT_THAT(p, Eq(buffer));
+    ASSERT_THAT(resource.remaining(), Eq(0u));
+}
+
+using monotonic_buffer_resource_death_test = monotonic_buffer_resource;
+
+TEST_F(monotonic_buffer_resource_death_test, aborts_when_the_buffer_is_exhausted)
+{
+    ASSERT_DEATH(resource.allocate(some_buffer_size + 1, 1), "");
+}
+
+TEST_F(arena_allocator, allocates_aligned_storage_from_its_resource)
+{
+    resource.allocate(1, 1);
+
+    auto p = allocator.allocate(2);
+
+    ASSERT_THAT(reinterpret_cast<unsigned char*>(p), Eq(buffer + alignof(int)));
+    ASSERT_THAT(resource.remaining(),
+                Eq(some_buffer_size - alignof(int) - 2 * sizeof(int)));
+}
+
+TEST_F(arena_allocator, compares_equal_to_a_rebound_copy)
+{
+    auto rebound = sut::arena_allocator<char>(allocator);
+
+    ASSERT_TRUE(rebound == allocator);
+    ASSERT_THAT(rebound.resource(), Eq(&resource));
+}
+
+TEST_F(arena_allocator, compares_unequal_to_an_allocator_of_another_resource)
+{
+    unsigned char other_buffer[some_buffer_size];
+    auto other_resource = sut::monotonic_buffer_resource(other_buffer);
+
+    ASSERT_TRUE(allocator != sut::arena_allocator<int>(other_resource));
+}
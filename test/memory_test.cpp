@@ -0,0 +1,209 @@
+#include "gmock/gmock.h"
+
+#include "sut/memory"
+
+#include <type_traits>
+#include <vector>
+
+using namespace testing;
+
+namespace
+{
+
+struct some_type
+{
+    some_type(int v1 = 0, int v2 = 0) : value{v1 + v2} {}
+    bool operator==(const some_type& other) const {return value == other.value;}
+
+    int value;
+};
+
+const some_type some_values[] = {3, 5, 8};
+const some_type some_value = 13;
+const sut::size_t some_count = 3;
+
+struct destroy_counter
+{
+    static inline int destroyed = 0;
+
+    ~destroy_counter() {++destroyed;}
+};
+
+struct uninitialized_storage : Test
+{
+    ~uninitialized_storage()
+    {
+        sut::destroy(elements(), elements() + constructed);
+    }
+
+    some_type* elements()
+    {
+        return reinterpret_cast<some_type*>(storage);
+    }
+
+    alignas(some_type) unsigned char storage[some_count * sizeof(some_type)];
+    sut::size_t constructed = 0;
+};
+
+struct uninitialized_copy : uninitialized_storage {};
+struct uninitialized_move : uninitialized_storage {};
+struct uninitialized_fill_n : uninitialized_storage {};
+struct uninitialized_value_construct_n : uninitialized_storage {};
+
+}
+
+TEST(addressof, returns_the_address_of_the_given_object)
+{
+    some_type object;
+
+    ASSERT_THAT(sut::addressof(object), Eq(&object));
+}
+
+TEST(to_address, returns_pointers_unchanged)
+{
+    some_type object;
+
+    ASSERT_THAT(sut::to_address(&object), Eq(&object));
+}
+
+TEST(to_address, returns_the_pointer_behind_a_fancy_pointer)
+{
+    struct fancy_pointer
+    {
+        some_type* operator->() const {return p;}
+
+        some_type* p;
+    };
+
+    some_type array[2];
+
+    ASSERT_THAT(sut::to_address(fancy_pointer{array + 2}), Eq(array + 2));
+}
+
+TEST(construct_at, constructs_an_object_from_the_given_arguments)
+{
+    alignas(some_type) unsigned char storage[sizeof(some_type)];
+    auto p = reinterpret_cast<some_type*>(storage);
+
+    auto constructed = sut::construct_at(p, 3, 5);
+
+    ASSERT_THAT(constructed, Eq(p));
+    ASSERT_THAT(p->value, Eq(8));
+
+    sut::destroy_at(p);
+}
+
+TEST(destroy, calls_the_destructor_of_every_element_in_the_range)
+{
+    destroy_counter elements[3];
+    destroy_counter::destroyed = 0;
+
+    sut::destroy(std::begin(elements), std::end(elements));
+
+    ASSERT_THAT(destroy_counter::destroyed, Eq(3));
+}
+
+TEST_F(uninitialized_copy, copy_constructs_the_elements_of_the_range)
+{
+    auto end = sut::uninitialized_copy(std::begin(some_values),
+                                       std::end(some_values), elements());
+    constructed = some_count;
+
+    ASSERT_THAT(end, Eq(elements() + some_count));
+    ASSERT_THAT(std::vector(elements(), end), ElementsAreArray(some_values));
+}
+
+TEST_F(uninitialized_move, move_constructs_the_elements_of_the_range)
+{
+    some_type values[] = {3, 5, 8};
+
+    auto end = sut::uninitialized_move(std::begin(values), std::end(values),
+                                       elements());
+    constructed = some_count;
+
+    ASSERT_THAT(end, Eq(elements() + some_count));
+    ASSERT_THAT(std::vector(elements(), end), ElementsAreArray(some_values));
+}
+
+TEST_F(uninitialized_fill_n, constructs_count_copies_of_the_given_value)
+{
+    auto end = sut::uninitialized_fill_n(elements(), some_count, some_value);
+    constructed = some_count;
+
+    ASSERT_THAT(end, Eq(elements() + some_count));
+    ASSERT_THAT(std::vector(elements(), end), Each(Eq(some_value)));
+}
+
+TEST_F(uninitialized_value_construct_n, constructs_count_value_initialized_elements)
+{
+    auto end = sut::uninitialized_value_construct_n(elements(), some_count);
+    constructed = some_count;
+
+    ASSERT_THAT(end, Eq(elements() + some_count));
+    ASSERT_THAT(std::vector(elements(), end), Each(Eq(some_type{})));
+}
+
+TEST(uninitialized_copy_trivial, copies_trivially_copyable_elements)
+{
+    int source[] = {3, 5, 8, 13};
+    int destination[4] = {};
+
+    auto end = sut::uninitialized_copy(std::cbegin(source), std::cend(source),
+                                       destination);
+
+    ASSERT_THAT(end, Eq(std::end(destination)));
+    ASSERT_THAT(destination, ElementsAreArray(source));
+}
+
+TEST(uninitialized_copy_trivial, returns_the_destination_given_an_empty_range)
+{
+    int destination[1] = {};
+
+    auto end = sut::uninitialized_copy(destination, destination, destination);
+
+    ASSERT_THAT(end, Eq(destination));
+}
+
+TEST(uninitialized_fill_n_trivial, fills_bytes_with_the_given_value)
+{
+    unsigned char destination[16] = {};
+
+    auto end = sut::uninitialized_fill_n(destination, 15, 0x5a);
+
+    ASSERT_THAT(end, Eq(destination + 15));
+    ASSERT_THAT(std::vector(destination, end), Each(Eq(0x5a)));
+    ASSERT_THAT(destination[15], Eq(0));
+}
+
+TEST(uninitialized_value_construct_n_trivial, zero_initializes_trivial_elements)
+{
+    int destination[4] = {1, 2, 3, 4};
+
+    sut::uninitialized_value_construct_n(destination, 3);
+
+    ASSERT_THAT(destination, ElementsAre(0, 0, 0, 4));
+}
+
+TEST(allocator, allocates_storage_for_the_given_number_of_elements)
+{
+    auto alloc = sut::allocator<some_type>();
+
+    auto p = alloc.allocate(some_count);
+    sut::uninitialized_copy(std::begin(some_values), std::end(some_values), p);
+
+    ASSERT_THAT(std::vector(p, p + some_count), ElementsAreArray(some_values));
+
+    sut::destroy(p, p + some_count);
+    alloc.deallocate(p, some_count);
+}
+
+TEST(allocator, is_empty)
+{
+    static_assert(std::is_empty_v<sut::allocator<some_type>>);
+}
+
+TEST(allocator, compares_equal_to_any_other_allocator)
+{
+    ASSERT_TRUE(sut::allocator<some_type>() == sut::allocator<int>());
+    ASSERT_FALSE(sut::allocator<some_type>() != sut::allocator<int>());
+}
@@ -0,0 +1,251 @@
+#include "gmock/gmock.h"
+
+#include "sut/numeric"
+#include "sut/cstdint"
+
+#include "test_iterators.hpp"
+
+#include <iterator>
+#include <utility>
+
+using namespace testing;
+
+namespace
+{
+
+using some_type = int;
+
+some_type some_array[] = {3, 1, 4, 1, 5, 9, 2, 6, 5};
+some_type some_other_array[] = {2, 7, 1, 8, 2, 8, 1, 8, 2};
+
+// Records the order in which it was applied.
+struct concatenate
+{
+    some_type operator()(some_type lhs, some_type rhs) const
+    {
+        return lhs * 10 + rhs;
+    }
+};
+
+}
+
+TEST(accumulate, sums_the_elements_onto_the_initial_value)
+{
+    auto sum = sut::accumulate(std::begin(some_array), std::end(some_array),
+                               10);
+
+    ASSERT_THAT(sum, Eq(46));
+}
+
+TEST(accumulate, applies_the_operation_from_left_to_right)
+{
+    some_type digits[] = {1, 2, 3, 4, 5, 6};
+
+    auto result = sut::accumulate(std::begin(digits), std::end(digits), 0,
+                                  concatenate());
+
+    ASSERT_THAT(result, Eq(123456));
+}
+
+TEST(accumulate, supports_input_iterators)
+{
+    auto [first, last] = make_range<input_iterator>(some_array);
+
+    ASSERT_THAT(sut::accumulate(first, last, 0), Eq(36));
+}
+
+TEST(reduce, sums_the_elements_of_ranges_of_every_size)
+{
+    for (auto n = 0; n <= 9; ++n)
+    {
+        auto sum = 0;
+        for (auto i = 0; i < n; ++i)
+            sum += some_array[i];
+
+        ASSERT_THAT(sut::reduce(some_array, some_array + n), Eq(sum));
+        ASSERT_THAT(sut::reduce(some_array, some_array + n, 1), Eq(sum + 1));
+    }
+}
+
+TEST(reduce, supports_input_iterators)
+{
+    auto [first, last] = make_range<input_iterator>(some_array);
+
+    ASSERT_THAT(sut::reduce(first, last, 0), Eq(36));
+}
+
+TEST(reduce, uses_the_given_operation)
+{
+    auto product = sut::reduce(std::begin(some_array), std::end(some_array),
+                               1, sut::multiplies<>());
+
+    ASSERT_THAT(product, Eq(3 * 4 * 5 * 9 * 2 * 6 * 5));
+}
+
+TEST(transform_reduce, computes_the_dot_product_of_two_ranges)
+{
+    auto dot = sut::transform_reduce(std::begin(some_array),
+                                     std::end(some_array),
+                                     std::begin(some_other_array), 0);
+
+    ASSERT_THAT(dot, Eq(6 + 7 + 4 + 8 + 10 + 72 + 2 + 48 + 10));
+}
+
+TEST(transform_reduce, transforms_the_elements_of_a_single_range)
+{
+    auto sum_of_squares = sut::transform_reduce(
+        std::begin(some_array), std::end(some_array), 0, sut::plus<>(),
+        [](some_type x) {return x * x;});
+
+    ASSERT_THAT(sum_of_squares, Eq(9 + 1 + 16 + 1 + 25 + 81 + 4 + 36 + 25));
+}
+
+TEST(transform_reduce, supports_input_iterators)
+{
+    auto [first1, last1] = make_range<input_iterator>(some_array);
+    auto [first2, last2] = make_range<input_iterator>(some_other_array);
+
+    auto dot = sut::transform_reduce(first1, last1, first2, 0);
+
+    ASSERT_THAT(dot, Eq(167));
+}
+
+TEST(inner_product, computes_the_dot_product_of_two_ranges)
+{
+    auto dot = sut::inner_product(std::begin(some_array),
+                                  std::end(some_array),
+                                  std::begin(some_other_array), 0);
+
+    ASSERT_THAT(dot, Eq(167));
+}
+
+TEST(inner_product, applies_the_operations_from_left_to_right)
+{
+    some_type digits[] = {1, 2, 3, 4, 5};
+    some_type ones[] = {1, 1, 1, 1, 1};
+
+    auto result = sut::inner_product(std::begin(digits), std::end(digits),
+                                     std::begin(ones), 0, concatenate(),
+                                     sut::multiplies<>());
+
+    ASSERT_THAT(result, Eq(12345));
+}
+
+TEST(partial_sum, writes_the_running_sums)
+{
+    some_type sums[4];
+
+    auto end = sut::partial_sum(std::begin(some_array),
+                                std::begin(some_array) + 4, std::begin(sums));
+
+    ASSERT_THAT(end, Eq(std::end(sums)));
+    ASSERT_THAT(sums, ElementsAre(3, 4, 8, 9));
+}
+
+TEST(partial_sum, supports_writing_in_place)
+{
+    some_type array[] = {1, 2, 3};
+
+    sut::partial_sum(std::begin(array), std::end(array), std::begin(array));
+
+    ASSERT_THAT(array, ElementsAre(1, 3, 6));
+}
+
+TEST(adjacent_difference, writes_the_differences_of_adjacent_elements)
+{
+    some_type differences[4];
+
+    auto end = sut::adjacent_difference(std::begin(some_array),
+                                        std::begin(some_array) + 4,
+                                        std::begin(differences));
+
+    ASSERT_THAT(end, Eq(std::end(differences)));
+    ASSERT_THAT(differences, ElementsAre(3, -2, 3, -3));
+}
+
+TEST(adjacent_difference, supports_writing_in_place)
+{
+    some_type array[] = {1, 3, 6};
+
+    sut::adjacent_difference(std::begin(array), std::end(array),
+                             std::begin(array));
+
+    ASSERT_THAT(array, ElementsAre(1, 2, 3));
+}
+
+TEST(iota, fills_the_range_with_increasing_values)
+{
+    some_type array[4];
+
+    sut::iota(std::begin(array), std::end(array), 5);
+
+    ASSERT_THAT(array, ElementsAre(5, 6, 7, 8));
+}
+
+TEST(gcd, returns_the_greatest_common_divisor)
+{
+    static_assert(sut::gcd(12, 18) == 6);
+    static_assert(sut::gcd(17u, 5u) == 1);
+    static_assert(sut::gcd(sut::uint8_t(128), sut::uint8_t(96)) == 32);
+}
+
+TEST(gcd, returns_the_other_value_when_one_is_zero)
+{
+    static_assert(sut::gcd(0, 7) == 7);
+    static_assert(sut::gcd(7, 0) == 7);
+    static_assert(sut::gcd(0, 0) == 0);
+}
+
+TEST(gcd, ignores_signs)
+{
+    static_assert(sut::gcd(-12, 18) == 6);
+    static_assert(sut::gcd(12l, -18) == 6);
+}
+
+TEST(gcd, agrees_with_euclid)
+{
+    for (unsigned a = 0; a < 100; ++a)
+    {
+        for (unsigned b = 0; b < 100; ++b)
+        {
+            auto x = a, y = b;
+            while (y != 0)
+                x = std::exchange(y, x % y);
+
+            ASSERT_THAT(sut::gcd(a, b), Eq(x));
+        }
+    }
+}
+
+TEST(lcm, returns_the_least_common_multiple)
+{
+    static_assert(sut::lcm(4, 6) == 12);
+    static_assert(sut::lcm(-4, 6) == 12);
+    static_assert(sut::lcm(0, 6) == 0);
+}
+
+TEST(midpoint, rounds_integers_towards_the_first_argument)
+{
+    static_assert(sut::midpoint(1, 4) == 2);
+    static_assert(sut::midpoint(4, 1) == 3);
+    static_assert(sut::midpoint(-3, 0) == -2);
+}
+
+TEST(midpoint, does_not_overflow_for_integers)
+{
+    static_assert(sut::midpoint(sut::uint8_t(250), sut::uint8_t(254)) == 252);
+    static_assert(sut::midpoint(sut::int8_t(-128), sut::int8_t(127)) == -1);
+    static_assert(sut::midpoint(sut::int8_t(127), sut::int8_t(-128)) == 0);
+}
+
+TEST(midpoint, returns_the_mean_of_floating_point_numbers)
+{
+    static_assert(sut::midpoint(1.0, 2.0) == 1.5);
+    ASSERT_THAT(sut::midpoint(1e308, 1.5e308), DoubleEq(1.25e308));
+}
+
+TEST(midpoint, returns_the_middle_of_two_pointers)
+{
+    ASSERT_THAT(sut::midpoint(std::begin(some_array), std::end(some_array)),
+                Eq(std::begin(some_array) + 4));
+}
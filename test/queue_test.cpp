@@ -0,0 +1,123 @@
+#include "gmock/gmock.h"
+
+#include <initializer_list>
+
+#include "sut/queue"
+#include "sut/inplace_vector"
+
+#include <vector>
+
+using namespace testing;
+
+namespace
+{
+
+using some_type = int;
+
+some_type some_array[] = {5, 1, 8, 3, 9, 2};
+
+// Pops all elements off the queue in order.
+template<class Queue>
+std::vector<some_type> drain(Queue& queue)
+{
+    auto values = std::vector<some_type>();
+
+    for (; !queue.empty(); queue.pop())
+        values.push_back(queue.top());
+
+    return values;
+}
+
+struct timer
+{
+    unsigned deadline;
+    int id;
+};
+
+struct later_deadline
+{
+    bool operator()(const timer& lhs, const timer& rhs) const
+    {
+        return lhs.deadline > rhs.deadline;
+    }
+};
+
+}
+
+TEST(a_priority_queue, is_empty_when_default_constructed)
+{
+    auto queue = sut::priority_queue<some_type>();
+
+    ASSERT_TRUE(queue.empty());
+    ASSERT_THAT(queue.size(), Eq(0u));
+}
+
+TEST(a_priority_queue, has_the_greatest_pushed_element_on_top)
+{
+    auto queue = sut::priority_queue<some_type>();
+
+    for (auto value : some_array)
+        queue.push(value);
+
+    ASSERT_THAT(queue.size(), Eq(std::size(some_array)));
+    ASSERT_THAT(queue.top(), Eq(9));
+}
+
+TEST(a_priority_queue, pops_elements_in_descending_order)
+{
+    auto queue = sut::priority_queue<some_type>(std::begin(some_array),
+                                                std::end(some_array));
+
+    ASSERT_THAT(drain(queue), ElementsAre(9, 8, 5, 3, 2, 1));
+}
+
+TEST(a_priority_queue, pops_elements_in_ascending_order_with_greater)
+{
+    auto queue = sut::priority_queue<some_type, sut::vector<some_type>,
+                                     sut::greater<some_type>>();
+
+    for (auto value : some_array)
+        queue.emplace(value);
+
+    ASSERT_THAT(drain(queue), ElementsAre(1, 2, 3, 5, 8, 9));
+}
+
+TEST(a_priority_queue, makes_a_heap_of_the_given_container)
+{
+    auto vec = sut::vector<some_type>(std::begin(some_array),
+                                      std::end(some_array));
+
+    auto queue = sut::priority_queue<some_type>(sut::less<some_type>(), vec);
+
+    ASSERT_THAT(drain(queue), ElementsAre(9, 8, 5, 3, 2, 1));
+}
+
+TEST(a_priority_queue, works_on_top_of_a_fixed_capacity_container)
+{
+    auto timers = sut::priority_queue<timer, sut::inplace_vector<timer, 8>,
+                                      later_deadline>();
+
+    timers.push({300, 1});
+    timers.push({100, 2});
+    timers.push({200, 3});
+
+    ASSERT_THAT(timers.top().id, Eq(2));
+    timers.pop();
+    ASSERT_THAT(timers.top().id, Eq(3));
+    timers.pop();
+    ASSERT_THAT(timers.top().id, Eq(1));
+}
+
+TEST(a_priority_queue, has_the_elements_of_the_other_queue_after_swap)
+{
+    auto queue1 = sut::priority_queue<some_type>(std::begin(some_array),
+                                                 std::end(some_array));
+    auto queue2 = sut::priority_queue<some_type>();
+    queue2.push(4);
+
+    swap(queue1, queue2);
+
+    ASSERT_THAT(queue1.size(), Eq(1u));
+    ASSERT_THAT(queue1.top(), Eq(4));
+    ASSERT_THAT(queue2.top(), Eq(9));
+}
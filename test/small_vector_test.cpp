@@ -0,0 +1,253 @@
+#include "gmock/gmock.h"
+
+#include "sut/small_vector"
+
+using namespace testing;
+
+namespace
+{
+
+using some_type = int;
+
+const sut::size_t some_inline_capacity = 4;
+const sut::size_t some_size = 3;
+const some_type some_value = 42;
+auto some_initializer_list = {2, 5, 1, 7, 5, 9};
+using some_small_vector = sut::small_vector<some_type, some_inline_capacity>;
+auto some_inline_vec = some_small_vector{2, 4, 3};
+auto some_heap_vec = some_small_vector{4, 2, 5, 6, 9, 0};
+
+struct instance_counter
+{
+    static inline int instances = 0;
+
+    instance_counter() {++instances;}
+    instance_counter(const instance_counter&) {++instances;}
+    instance_counter(instance_counter&&) noexcept {++instances;}
+    ~instance_counter() {--instances;}
+};
+
+// Counts its instances and throws from its copy constructor once copies_left
+// more copies have been made. Without a move constructor, moves copy too.
+struct throwing_copy_counter
+{
+    static inline int instances = 0;
+    static inline int copies_left = -1;
+
+    explicit throwing_copy_counter(int value = 0) : value{value} {++instances;}
+
+    throwing_copy_counter(const throwing_copy_counter& other)
+        : value{other.value}
+    {
+        if (copies_left-- == 0)
+            throw other.value;
+
+        ++instances;
+    }
+
+    ~throwing_copy_counter() {--instances;}
+
+    int value;
+};
+
+}
+
+TEST(a_small_vector, has_size_zero_and_the_inline_capacity_when_default_constructed)
+{
+    auto vec = some_small_vector();
+
+    ASSERT_TRUE(vec.empty());
+    ASSERT_THAT(vec.capacity(), Eq(some_inline_capacity));
+    ASSERT_TRUE(vec.is_inline());
+}
+
+TEST(a_small_vector, stores_its_elements_inline_while_they_fit)
+{
+    auto vec = some_small_vector();
+
+    for (sut::size_t i = 0; i < some_inline_capacity; ++i)
+        vec.push_back(some_value);
+
+    ASSERT_TRUE(vec.is_inline());
+    ASSERT_THAT(vec, Each(Eq(some_value)));
+}
+
+TEST(a_small_vector, spills_to_the_heap_when_growing_beyond_the_inline_capacity)
+{
+    auto vec = some_small_vector();
+
+    for (auto value : some_initializer_list)
+        vec.push_back(value);
+
+    ASSERT_FALSE(vec.is_inline());
+    ASSERT_THAT(vec.capacity(), Ge(some_initializer_list.size()));
+    ASSERT_THAT(vec, ElementsAreArray(some_initializer_list));
+}
+
+TEST(a_small_vector, contains_count_elements_equal_to_the_given_value)
+{
+    auto vec = some_small_vector(some_size, some_value);
+
+    ASSERT_THAT(vec, ElementsAreArray({some_value, some_value, some_value}));
+}
+
+TEST(a_small_vector, contains_count_default_constructed_elements_when_no_value_given)
+{
+    auto vec = some_small_vector(some_size);
+
+    ASSERT_THAT(vec, ElementsAreArray({some_type{}, some_type{}, some_type{}}));
+}
+
+TEST(a_small_vector, contains_the_element_from_the_given_initializer_list)
+{
+    auto vec = some_small_vector(some_initializer_list);
+
+    ASSERT_THAT(vec, ElementsAreArray(some_initializer_list));
+}
+
+TEST(a_small_vector, has_the_same_elements_as_the_source_vector_it_was_copied_from)
+{
+    auto inline_vec = some_inline_vec;
+    auto heap_vec = some_heap_vec;
+
+    ASSERT_THAT(inline_vec, ElementsAreArray(some_inline_vec));
+    ASSERT_THAT(heap_vec, ElementsAreArray(some_heap_vec));
+}
+
+TEST(a_small_vector, has_the_same_elements_as_the_inline_source_vector_it_was_moved_from)
+{
+    auto source_vec = some_inline_vec;
+
+    auto vec = std::move(source_vec);
+
+    ASSERT_THAT(vec, ElementsAreArray(some_inline_vec));
+    ASSERT_TRUE(source_vec.empty());
+}
+
+TEST(a_small_vector, takes_over_the_heap_storage_of_the_source_vector_it_was_moved_from)
+{
+    auto source_vec = some_heap_vec;
+    auto data = source_vec.data();
+
+    auto vec = std::move(source_vec);
+
+    ASSERT_THAT(vec.data(), Eq(data));
+    ASSERT_THAT(vec, ElementsAreArray(some_heap_vec));
+    ASSERT_TRUE(source_vec.empty());
+    ASSERT_TRUE(source_vec.is_inline());
+}
+
+TEST(a_small_vector, has_the_same_elements_as_the_source_vector_it_was_assigned_from)
+{
+    auto vec = some_inline_vec;
+
+    vec = some_heap_vec;
+
+    ASSERT_THAT(vec, ElementsAreArray(some_heap_vec));
+}
+
+TEST(a_small_vector, has_the_same_elements_as_the_other_vector_after_swap)
+{
+    auto vec1 = some_inline_vec;
+    auto vec2 = some_heap_vec;
+
+    sut::swap(vec1, vec2);
+
+    ASSERT_THAT(vec1, ElementsAreArray(some_heap_vec));
+    ASSERT_THAT(vec2, ElementsAreArray(some_inline_vec));
+}
+
+TEST(a_small_vector, supports_pushing_back_one_of_its_own_elements_when_full)
+{
+    auto vec = some_small_vector(some_inline_capacity, some_value);
+
+    vec.push_back(vec.front());
+
+    ASSERT_THAT(vec.back(), Eq(some_value));
+}
+
+TEST(a_small_vector, moves_back_inline_on_shrink_to_fit_when_its_elements_fit)
+{
+    auto vec = some_heap_vec;
+    vec.pop_back();
+    vec.pop_back();
+    vec.pop_back();
+
+    vec.shrink_to_fit();
+
+    ASSERT_TRUE(vec.is_inline());
+    ASSERT_THAT(vec, ElementsAreArray(some_heap_vec.begin(),
+                                      some_heap_vec.begin() + 3));
+}
+
+TEST(a_small_vector, returns_the_element_at_the_given_index_for_array_access_and_at)
+{
+    ASSERT_THAT(some_heap_vec[4], Eq(*(some_heap_vec.begin() + 4)));
+    ASSERT_THAT(some_heap_vec.at(4), Eq(*(some_heap_vec.begin() + 4)));
+}
+
+TEST(a_small_vector, destroys_its_elements)
+{
+    instance_counter::instances = 0;
+
+    {
+        auto vec = sut::small_vector<instance_counter, 2>(1);
+        vec.emplace_back();
+        vec.emplace_back();
+        auto copy = vec;
+        copy.pop_back();
+    }
+
+    ASSERT_THAT(instance_counter::instances, Eq(0));
+}
+
+TEST(a_small_vector, is_unchanged_when_copying_an_element_throws_while_growing)
+{
+    throwing_copy_counter::instances = 0;
+
+    {
+        auto vec = sut::small_vector<throwing_copy_counter,
+                                     some_inline_capacity>();
+
+        for (auto i = 0; i < int(some_inline_capacity); ++i)
+            vec.emplace_back(i);
+
+        throwing_copy_counter::copies_left = 2;
+        ASSERT_THROW(vec.push_back(throwing_copy_counter(99)), int);
+        throwing_copy_counter::copies_left = -1;
+
+        ASSERT_TRUE(vec.is_inline());
+        ASSERT_THAT(vec.size(), Eq(some_inline_capacity));
+        ASSERT_THAT(vec.back().value, Eq(3));
+        ASSERT_THAT(throwing_copy_counter::instances, Eq(4));
+    }
+
+    ASSERT_THAT(throwing_copy_counter::instances, Eq(0));
+}
+
+TEST(a_small_vector, has_the_number_of_elements_that_fit_in_memory_as_max_size)
+{
+    static_assert(some_small_vector::max_size() ==
+                  sut::size_t(-1) / sizeof(some_type));
+}
+
+TEST(a_small_vector_death_test, aborts_when_reserving_beyond_its_max_size)
+{
+    auto vec = some_small_vector();
+
+    ASSERT_DEATH(vec.reserve(vec.max_size() + 1), "");
+}
+
+TEST(a_small_vector, keeps_its_nested_heap_vectors_when_growing)
+{
+    using inner_type = sut::small_vector<some_type, 1>;
+    auto vec = sut::small_vector<inner_type, 1>();
+
+    vec.push_back(inner_type{1, 2, 3});
+    vec.push_back(inner_type{4, 5});
+    vec.push_back(inner_type{6});
+
+    ASSERT_THAT(vec[0], ElementsAre(1, 2, 3));
+    ASSERT_THAT(vec[1], ElementsAre(4, 5));
+    ASSERT_THAT(vec[2], ElementsAre(6));
+}
@@ -0,0 +1,127 @@
+#ifndef STDAVR_TEST_ITERATORS_HPP
+#define STDAVR_TEST_ITERATORS_HPP
+
+#include "sut/iterator"
+
+#include <cstddef>
+#include <type_traits>
+
+// Iterator over an array that only supports the operations required by
+// Category so that tests can check which iterator operations algorithms use.
+template<typename Category, typename T>
+class test_iterator
+{
+    template<typename C, typename Base>
+    using require = std::enable_if_t<std::is_base_of_v<Base, C>, int>;
+
+public:
+
+    using value_type = std::remove_cv_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+    using iterator_category = Category;
+    using iterator_concept = Category;
+
+    test_iterator() = default;
+    explicit test_iterator(T* p) : p_{p} {}
+
+    T* base() const {return p_;}
+
+    reference operator*() const {return *p_;}
+    pointer operator->() const {return p_;}
+
+    test_iterator& operator++() {++p_; return *this;}
+    test_iterator operator++(int) {auto tmp = *this; ++p_; return tmp;}
+
+    friend bool operator==(test_iterator lhs, test_iterator rhs)
+    {
+        return lhs.p_ == rhs.p_;
+    }
+
+    friend bool operator!=(test_iterator lhs, test_iterator rhs)
+    {
+        return lhs.p_ != rhs.p_;
+    }
+
+    template<typename C = Category,
+             require<C, sut::bidirectional_iterator_tag> = 0>
+    test_iterator& operator--() {--p_; return *this;}
+
+    template<typename C = Category,
+             require<C, sut::bidirectional_iterator_tag> = 0>
+    test_iterator operator--(int) {auto tmp = *this; --p_; return tmp;}
+
+    template<typename C = Category,
+             require<C, sut::random_access_iterator_tag> = 0>
+    test_iterator& operator+=(difference_type n) {p_ += n; return *this;}
+
+    template<typename C = Category,
+             require<C, sut::random_access_iterator_tag> = 0>
+    test_iterator& operator-=(difference_type n) {p_ -= n; return *this;}
+
+    template<typename C = Category,
+             require<C, sut::random_access_iterator_tag> = 0>
+    test_iterator operator+(difference_type n) const
+    {
+        return test_iterator{p_ + n};
+    }
+
+    template<typename C = Category,
+             require<C, sut::random_access_iterator_tag> = 0>
+    test_iterator operator-(difference_type n) const
+    {
+        return test_iterator{p_ - n};
+    }
+
+    template<typename C = Category,
+             require<C, sut::random_access_iterator_tag> = 0>
+    difference_type operator-(test_iterator other) const
+    {
+        return p_ - other.p_;
+    }
+
+    template<typename C = Category,
+             require<C, sut::random_access_iterator_tag> = 0>
+    reference operator[](difference_type n) const {return p_[n];}
+
+    template<typename C = Category,
+             require<C, sut::random_access_iterator_tag> = 0>
+    bool operator<(test_iterator other) const {return p_ < other.p_;}
+
+private:
+
+    T* p_ = nullptr;
+};
+
+template<typename T>
+using input_iterator = test_iterator<sut::input_iterator_tag, T>;
+
+template<typename T>
+using forward_iterator = test_iterator<sut::forward_iterator_tag, T>;
+
+template<typename T>
+using bidirectional_iterator =
+    test_iterator<sut::bidirectional_iterator_tag, T>;
+
+template<typename T>
+using random_access_iterator =
+    test_iterator<sut::random_access_iterator_tag, T>;
+
+template<typename T>
+using contiguous_iterator = test_iterator<sut::contiguous_iterator_tag, T>;
+
+// Returns a [first, last) pair of Iterator<T> over the given array.
+template<template<typename> class Iterator, typename T, std::size_t N>
+auto make_range(T (&array)[N])
+{
+    struct range
+    {
+        Iterator<T> first;
+        Iterator<T> last;
+    };
+
+    return range{Iterator<T>{array}, Iterator<T>{array + N}};
+}
+
+#endif
@@ -145,3 +145,39 @@ TEST(tuple_element_tuple, returns_correct_types)
     StaticAssertTypeEq<sut::tuple_element_t<0, tup_type>, int>();
     StaticAssertTypeEq<sut::tuple_element_t<1, tup_type>, char>();
 }
+
+TEST(tuple, keeps_elements_of_the_same_type_apart)
+{
+    sut::tuple<int, int, int> tup{1, 2, 3};
+
+    sut::get<1>(tup) = 5;
+
+    ASSERT_EQ(sut::get<0>(tup), 1);
+    ASSERT_EQ(sut::get<1>(tup), 5);
+    ASSERT_EQ(sut::get<2>(tup), 3);
+}
+
+TEST(tuple, can_be_used_in_constant_expressions)
+{
+    constexpr auto tup = sut::make_tuple(1, 'a', 3L);
+
+    static_assert(sut::get<0>(tup) == 1);
+    static_assert(sut::get<2>(tup) == 3L);
+}
+
+TEST(make_tuple, decays_the_given_types)
+{
+    const int value = 1;
+    using tup_type = decltype(sut::make_tuple(value, "a"));
+
+    StaticAssertTypeEq<tup_type, sut::tuple<int, const char*>>();
+}
+
+TEST(tuple_element_tuple, returns_correct_types_for_many_elements)
+{
+    using tup_type = sut::tuple<int, char, long, short, int, bool, char*>;
+
+    StaticAssertTypeEq<sut::tuple_element_t<2, tup_type>, long>();
+    StaticAssertTypeEq<sut::tuple_element_t<5, tup_type>, bool>();
+    StaticAssertTypeEq<sut::tuple_element_t<6, tup_type>, char*>();
+}
@@ -408,3 +408,447 @@ TEST(enable_if, does_not_have_a_type_typedef_when_given_false)
     // the second overload although the provided argument is a better match.
     static_assert(enable_if_test<false>(0l));
 }
+
+TEST(conditional, is_the_first_type_when_given_true)
+{
+    StaticAssertTypeEq<sut::conditional_t<true, some_type, some_type2>,
+                       some_type>();
+}
+
+TEST(conditional, is_the_second_type_when_given_false)
+{
+    StaticAssertTypeEq<sut::conditional_t<false, some_type, some_type2>,
+                       some_type2>();
+}
+
+TEST(is_constructible, is_true_when_a_matching_constructor_exists)
+{
+    struct some_class_type {some_class_type(int, double) {}};
+
+    static_assert(sut::is_constructible_v<some_class_type, int, double>);
+}
+
+TEST(is_constructible, is_false_when_no_matching_constructor_exists)
+{
+    struct some_class_type {some_class_type(int, double) {}};
+
+    static_assert(!sut::is_constructible_v<some_class_type, int>);
+}
+
+TEST(is_nothrow_constructible, is_true_for_noexcept_constructors)
+{
+    struct some_class_type {some_class_type(int) noexcept {}};
+
+    static_assert(sut::is_nothrow_constructible_v<some_class_type, int>);
+}
+
+TEST(is_nothrow_constructible, is_false_for_potentially_throwing_constructors)
+{
+    struct some_class_type {some_class_type(int) {}};
+
+    static_assert(!sut::is_nothrow_constructible_v<some_class_type, int>);
+}
+
+TEST(is_copy_constructible, is_false_for_class_types_with_deleted_copy_constructor)
+{
+    struct some_class_type {some_class_type(const some_class_type&) = delete;};
+
+    static_assert(!sut::is_copy_constructible_v<some_class_type>);
+}
+
+TEST(is_nothrow_move_constructible, is_true_for_integral_types)
+{
+    static_assert(sut::is_nothrow_move_constructible_v<some_integral_type>);
+}
+
+TEST(is_nothrow_move_constructible, is_false_for_class_types_with_throwing_move_constructor)
+{
+    struct some_class_type {some_class_type(some_class_type&&) {}};
+
+    static_assert(sut::is_move_constructible_v<some_class_type>);
+    static_assert(!sut::is_nothrow_move_constructible_v<some_class_type>);
+}
+
+TEST(is_trivially_copyable, is_true_for_integral_types)
+{
+    static_assert(sut::is_trivially_copyable_v<some_integral_type>);
+}
+
+TEST(is_trivially_copyable, is_false_for_class_types_with_non_default_copy_constructor)
+{
+    struct some_class_type {some_class_type(const some_class_type&) {}};
+
+    static_assert(!sut::is_trivially_copyable_v<some_class_type>);
+}
+
+TEST(is_trivially_relocatable, is_true_for_trivially_copyable_types)
+{
+    static_assert(sut::is_trivially_relocatable_v<some_integral_type>);
+}
+
+TEST(is_trivially_relocatable, is_false_for_class_types_with_non_default_copy_constructor)
+{
+    struct some_class_type {some_class_type(const some_class_type&) {}};
+
+    static_assert(!sut::is_trivially_relocatable_v<some_class_type>);
+}
+
+TEST(is_same, is_true_for_identical_types)
+{
+    static_assert(sut::is_same_v<some_type, some_type>);
+}
+
+TEST(is_same, is_false_for_differently_qualified_types)
+{
+    static_assert(!sut::is_same_v<some_type, const some_type>);
+}
+
+TEST(remove_cv, removes_const_and_volatile)
+{
+    StaticAssertTypeEq<sut::remove_cv_t<const volatile some_type>, some_type>();
+    StaticAssertTypeEq<sut::remove_cv_t<const some_type>, some_type>();
+    StaticAssertTypeEq<sut::remove_cv_t<volatile some_type>, some_type>();
+}
+
+TEST(remove_cv, keeps_the_qualifiers_of_pointees_intact)
+{
+    StaticAssertTypeEq<sut::remove_cv_t<const some_type*>, const some_type*>();
+}
+
+TEST(is_pointer, is_true_for_cv_qualified_pointers)
+{
+    static_assert(sut::is_pointer_v<some_type*>);
+    static_assert(sut::is_pointer_v<some_type* const>);
+}
+
+TEST(is_pointer, is_false_for_non_pointers)
+{
+    static_assert(!sut::is_pointer_v<some_type>);
+    static_assert(!sut::is_pointer_v<some_class_type>);
+}
+
+TEST(is_trivially_default_constructible, is_true_for_integral_types)
+{
+    static_assert(sut::is_trivially_default_constructible_v<some_integral_type>);
+}
+
+TEST(is_trivially_default_constructible, is_false_for_class_types_with_non_default_default_constructor)
+{
+    static_assert(!sut::is_trivially_default_constructible_v<some_non_trivial_type>);
+}
+
+TEST(is_trivially_destructible, is_true_for_integral_types)
+{
+    static_assert(sut::is_trivially_destructible_v<some_integral_type>);
+}
+
+TEST(is_trivially_destructible, is_false_for_class_types_with_user_provided_destructor)
+{
+    struct some_class_type {~some_class_type() {}};
+
+    static_assert(!sut::is_trivially_destructible_v<some_class_type>);
+}
+
+TEST(is_trivially_destructible, is_false_for_class_types_with_deleted_destructor)
+{
+    struct some_class_type {~some_class_type() = delete;};
+
+    static_assert(!sut::is_trivially_destructible_v<some_class_type>);
+}
+
+TEST(is_trivially_destructible, is_false_for_class_types_with_private_destructor)
+{
+    class some_class_type {~some_class_type() = default;};
+
+    static_assert(!sut::is_trivially_destructible_v<some_class_type>);
+}
+
+TEST(is_trivially_destructible, is_false_for_arrays_of_unknown_bound)
+{
+    static_assert(!sut::is_trivially_destructible_v<some_integral_type[]>);
+    static_assert(sut::is_trivially_destructible_v<some_integral_type[2]>);
+}
+
+TEST(is_integral, is_true_for_integral_types)
+{
+    static_assert(sut::is_integral_v<bool>);
+    static_assert(sut::is_integral_v<char>);
+    static_assert(sut::is_integral_v<const unsigned long long>);
+}
+
+TEST(is_integral, is_false_for_other_types)
+{
+    static_assert(!sut::is_integral_v<float>);
+    static_assert(!sut::is_integral_v<int*>);
+    static_assert(!sut::is_integral_v<int&>);
+}
+
+TEST(is_floating_point, is_true_for_floating_point_types)
+{
+    static_assert(sut::is_floating_point_v<float>);
+    static_assert(sut::is_floating_point_v<volatile double>);
+    static_assert(sut::is_floating_point_v<long double>);
+}
+
+TEST(is_floating_point, is_false_for_other_types)
+{
+    static_assert(!sut::is_floating_point_v<int>);
+    static_assert(!sut::is_floating_point_v<double*>);
+}
+
+TEST(make_unsigned, returns_the_unsigned_type_of_the_same_size)
+{
+    static_assert(sut::is_same_v<sut::make_unsigned_t<signed char>,
+                                 unsigned char>);
+    static_assert(sut::is_same_v<sut::make_unsigned_t<long>, unsigned long>);
+    static_assert(sut::is_same_v<sut::make_unsigned_t<unsigned>, unsigned>);
+}
+
+namespace
+{
+
+struct some_final_type final {};
+struct some_polymorphic_base {virtual ~some_polymorphic_base() = default;};
+struct some_aggregate_type {int i; double d;};
+struct some_padded_type {char c; int i;};
+
+struct some_throwing_type
+{
+    some_throwing_type(const some_throwing_type&) noexcept(false);
+    some_throwing_type& operator=(const some_throwing_type&) noexcept(false);
+    ~some_throwing_type() noexcept(false);
+};
+
+struct some_non_movable_type
+{
+    some_non_movable_type(some_non_movable_type&&) = delete;
+};
+
+class some_private_destructor_type
+{
+    ~some_private_destructor_type() = default;
+};
+
+struct some_swappable_type {};
+
+void swap(some_swappable_type&, some_swappable_type&) noexcept {}
+
+struct some_convertible_type
+{
+    operator some_type() const {return 0;}
+};
+
+}
+
+TEST(intrinsic_traits, query_the_compiler)
+{
+    static_assert(sut::is_final_v<some_final_type>);
+    static_assert(!sut::is_final_v<some_class_type>);
+    static_assert(sut::is_aggregate_v<some_aggregate_type>);
+    static_assert(!sut::is_aggregate_v<some_non_trivial_type>);
+    static_assert(sut::has_virtual_destructor_v<some_polymorphic_base>);
+    static_assert(!sut::has_virtual_destructor_v<some_class_type>);
+    static_assert(sut::has_unique_object_representations_v<some_type>);
+    static_assert(!sut::has_unique_object_representations_v<some_padded_type>);
+}
+
+TEST(primary_type_categories, classify_fundamental_types)
+{
+    static_assert(sut::is_void_v<const void>);
+    static_assert(!sut::is_void_v<void*>);
+    static_assert(sut::is_null_pointer_v<decltype(nullptr)>);
+    static_assert(!sut::is_null_pointer_v<void*>);
+    static_assert(sut::is_array_v<some_type[]>);
+    static_assert(sut::is_array_v<some_type[2][3]>);
+    static_assert(!sut::is_array_v<some_type*>);
+    static_assert(sut::is_bounded_array_v<some_type[2]>);
+    static_assert(!sut::is_bounded_array_v<some_type[]>);
+    static_assert(sut::is_unbounded_array_v<some_type[]>);
+    static_assert(!sut::is_unbounded_array_v<some_type[2]>);
+}
+
+TEST(primary_type_categories, classify_references)
+{
+    static_assert(sut::is_lvalue_reference_v<some_type&>);
+    static_assert(!sut::is_lvalue_reference_v<some_type&&>);
+    static_assert(sut::is_rvalue_reference_v<some_type&&>);
+    static_assert(!sut::is_rvalue_reference_v<some_type&>);
+    static_assert(sut::is_reference_v<some_type&>);
+    static_assert(sut::is_reference_v<some_type&&>);
+    static_assert(!sut::is_reference_v<some_type>);
+}
+
+TEST(primary_type_categories, classify_functions_and_member_pointers)
+{
+    using member_object = some_type some_aggregate_type::*;
+    using member_function = void (some_class_type::*)() const;
+
+    static_assert(sut::is_function_v<void(some_type)>);
+    static_assert(sut::is_function_v<some_type() const &>);
+    static_assert(!sut::is_function_v<void(*)()>);
+    static_assert(!sut::is_function_v<some_type&>);
+    static_assert(sut::is_member_pointer_v<const member_object>);
+    static_assert(sut::is_member_object_pointer_v<member_object>);
+    static_assert(!sut::is_member_object_pointer_v<member_function>);
+    static_assert(sut::is_member_function_pointer_v<member_function>);
+    static_assert(!sut::is_member_function_pointer_v<member_object>);
+}
+
+TEST(composite_type_categories, group_the_primary_categories)
+{
+    static_assert(sut::is_arithmetic_v<const bool>);
+    static_assert(sut::is_arithmetic_v<double>);
+    static_assert(!sut::is_arithmetic_v<some_enum_type>);
+    static_assert(sut::is_fundamental_v<void>);
+    static_assert(sut::is_fundamental_v<decltype(nullptr)>);
+    static_assert(!sut::is_fundamental_v<some_type*>);
+    static_assert(sut::is_compound_v<some_class_type>);
+    static_assert(sut::is_scalar_v<some_enum_class_type>);
+    static_assert(sut::is_scalar_v<some_type some_aggregate_type::*>);
+    static_assert(!sut::is_scalar_v<some_class_type>);
+    static_assert(sut::is_object_v<some_type[2]>);
+    static_assert(!sut::is_object_v<some_type&>);
+    static_assert(!sut::is_object_v<void()>);
+}
+
+TEST(type_properties, report_qualifiers_and_signedness)
+{
+    static_assert(sut::is_volatile_v<volatile some_type>);
+    static_assert(!sut::is_volatile_v<volatile some_type*>);
+    static_assert(sut::is_signed_v<signed char>);
+    static_assert(sut::is_signed_v<double>);
+    static_assert(!sut::is_signed_v<unsigned>);
+    static_assert(!sut::is_signed_v<some_enum_type>);
+    static_assert(sut::is_unsigned_v<bool>);
+    static_assert(!sut::is_unsigned_v<float>);
+}
+
+TEST(make_signed, returns_the_signed_type_of_the_same_size)
+{
+    StaticAssertTypeEq<sut::make_signed_t<unsigned char>, signed char>();
+    StaticAssertTypeEq<sut::make_signed_t<unsigned long>, long>();
+    StaticAssertTypeEq<sut::make_signed_t<int>, int>();
+}
+
+TEST(underlying_type, returns_the_underlying_type_of_enums)
+{
+    enum some_enum : unsigned char {};
+
+    StaticAssertTypeEq<sut::underlying_type_t<some_enum>, unsigned char>();
+    StaticAssertTypeEq<sut::underlying_type_t<some_enum_class_type>, int>();
+}
+
+TEST(type_transformations, add_and_remove_qualifiers_pointers_and_extents)
+{
+    StaticAssertTypeEq<sut::add_cv_t<some_type>, const volatile some_type>();
+    StaticAssertTypeEq<sut::add_const_t<some_type&>, some_type&>();
+    StaticAssertTypeEq<sut::remove_cvref_t<const some_type&>, some_type>();
+    StaticAssertTypeEq<sut::remove_pointer_t<some_type* const>, some_type>();
+    StaticAssertTypeEq<sut::add_pointer_t<some_type&>, some_type*>();
+    StaticAssertTypeEq<sut::add_pointer_t<void() const>, void() const>();
+    StaticAssertTypeEq<sut::remove_extent_t<some_type[2][3]>, some_type[3]>();
+    StaticAssertTypeEq<sut::remove_all_extents_t<some_type[][3]>,
+                       some_type>();
+    StaticAssertTypeEq<sut::type_identity_t<some_type>, some_type>();
+}
+
+TEST(type_transformations, add_references_where_they_can_be_formed)
+{
+    StaticAssertTypeEq<sut::add_lvalue_reference_t<some_type>, some_type&>();
+    StaticAssertTypeEq<sut::add_lvalue_reference_t<some_type&&>,
+                       some_type&>();
+    StaticAssertTypeEq<sut::add_rvalue_reference_t<some_type>, some_type&&>();
+    StaticAssertTypeEq<sut::add_rvalue_reference_t<some_type&>, some_type&>();
+    StaticAssertTypeEq<sut::add_lvalue_reference_t<void>, void>();
+    StaticAssertTypeEq<sut::add_rvalue_reference_t<const void>, const void>();
+}
+
+TEST(decay, applies_the_conversions_of_passing_by_value)
+{
+    StaticAssertTypeEq<sut::decay_t<const some_type&>, some_type>();
+    StaticAssertTypeEq<sut::decay_t<some_type[2]>, some_type*>();
+    StaticAssertTypeEq<sut::decay_t<const some_type(&)[2]>,
+                       const some_type*>();
+    StaticAssertTypeEq<sut::decay_t<void(some_type)>, void(*)(some_type)>();
+}
+
+TEST(logical_operations, combine_traits)
+{
+    static_assert(sut::conjunction_v<>);
+    static_assert(sut::conjunction_v<sut::true_type, sut::is_integral<int>>);
+    static_assert(!sut::conjunction_v<sut::true_type, sut::false_type>);
+    static_assert(!sut::disjunction_v<>);
+    static_assert(sut::disjunction_v<sut::false_type, sut::true_type>);
+    static_assert(sut::negation_v<sut::false_type>);
+
+    // conjunction stops instantiating at the first false trait.
+    static_assert(!sut::conjunction_v<sut::false_type, sut::is_integral<int>,
+                                      sut::make_unsigned<float>>);
+}
+
+TEST(constructibility, is_reported_for_special_members)
+{
+    static_assert(sut::is_default_constructible_v<some_type>);
+    static_assert(!sut::is_default_constructible_v<some_type&>);
+    static_assert(sut::is_nothrow_default_constructible_v<some_class_type>);
+    static_assert(sut::is_nothrow_copy_constructible_v<some_type>);
+    static_assert(!sut::is_nothrow_copy_constructible_v<some_throwing_type>);
+    static_assert(sut::is_trivially_copy_constructible_v<some_type>);
+    static_assert(sut::is_trivially_move_constructible_v<some_class_type>);
+    static_assert(!sut::is_trivially_copy_constructible_v<
+        some_throwing_type>);
+}
+
+TEST(assignability, is_reported_for_special_members)
+{
+    static_assert(sut::is_assignable_v<some_type&, double>);
+    static_assert(!sut::is_assignable_v<some_type, some_type>);
+    static_assert(sut::is_copy_assignable_v<some_type>);
+    static_assert(!sut::is_move_assignable_v<some_non_movable_type>);
+    static_assert(sut::is_nothrow_copy_assignable_v<some_type>);
+    static_assert(!sut::is_nothrow_copy_assignable_v<some_throwing_type>);
+    static_assert(sut::is_nothrow_move_assignable_v<some_class_type>);
+    static_assert(sut::is_trivially_copy_assignable_v<some_aggregate_type>);
+    static_assert(!sut::is_trivially_move_assignable_v<some_throwing_type>);
+    static_assert(sut::is_trivially_assignable_v<some_type&, some_type>);
+}
+
+TEST(destructibility, is_reported_for_all_kinds_of_types)
+{
+    static_assert(sut::is_destructible_v<some_type>);
+    static_assert(sut::is_destructible_v<some_class_type[2]>);
+    static_assert(sut::is_destructible_v<some_private_destructor_type&>);
+    static_assert(!sut::is_destructible_v<some_private_destructor_type>);
+    static_assert(!sut::is_destructible_v<void>);
+    static_assert(!sut::is_destructible_v<void()>);
+    static_assert(!sut::is_destructible_v<some_type[]>);
+    static_assert(sut::is_nothrow_destructible_v<some_class_type>);
+    static_assert(!sut::is_nothrow_destructible_v<some_throwing_type>);
+}
+
+TEST(is_convertible, is_true_for_implicit_conversions)
+{
+    static_assert(sut::is_convertible_v<some_type, double>);
+    static_assert(sut::is_convertible_v<some_convertible_type, some_type>);
+    static_assert(sut::is_convertible_v<some_type[2], const some_type*>);
+    static_assert(sut::is_convertible_v<void, void>);
+    static_assert(!sut::is_convertible_v<some_type*, some_type>);
+    static_assert(!sut::is_convertible_v<some_type, void>);
+    static_assert(!sut::is_convertible_v<some_non_movable_type,
+                                         some_non_movable_type>);
+}
+
+TEST(is_swappable, uses_custom_swap_overloads_and_the_default_one)
+{
+    static_assert(sut::is_swappable_v<some_type>);
+    static_assert(sut::is_swappable_v<some_swappable_type>);
+    static_assert(!sut::is_swappable_v<some_non_movable_type>);
+    static_assert(!sut::is_swappable_with_v<some_type&, double&>);
+}
+
+TEST(is_nothrow_swappable, is_true_when_the_used_swap_is_noexcept)
+{
+    static_assert(sut::is_nothrow_swappable_v<some_type>);
+    static_assert(sut::is_nothrow_swappable_v<some_swappable_type>);
+    static_assert(!sut::is_nothrow_swappable_v<some_throwing_type>);
+}
@@ -55,3 +55,95 @@ TEST(swap, swaps_the_given_values)
     ASSERT_THAT(value1, Eq(some_value2));
     ASSERT_THAT(value2, Eq(some_value1));
 }
+
+namespace
+{
+
+struct some_nothrow_movable_type
+{
+    some_nothrow_movable_type(const some_nothrow_movable_type&);
+    some_nothrow_movable_type(some_nothrow_movable_type&&) noexcept;
+};
+
+struct some_throwing_movable_type
+{
+    some_throwing_movable_type(const some_throwing_movable_type&);
+    some_throwing_movable_type(some_throwing_movable_type&&);
+};
+
+struct some_move_only_type
+{
+    some_move_only_type(const some_move_only_type&) = delete;
+    some_move_only_type(some_move_only_type&&);
+};
+
+}
+
+TEST(move_if_noexcept, returns_an_rvalue_given_a_nothrow_movable_type)
+{
+    using moved_type = decltype(sut::move_if_noexcept(
+        std::declval<some_nothrow_movable_type&>()));
+
+    StaticAssertTypeEq<moved_type, some_nothrow_movable_type&&>();
+}
+
+TEST(move_if_noexcept, returns_a_const_lvalue_given_a_throwing_movable_type)
+{
+    using moved_type = decltype(sut::move_if_noexcept(
+        std::declval<some_throwing_movable_type&>()));
+
+    StaticAssertTypeEq<moved_type, const some_throwing_movable_type&>();
+}
+
+TEST(move_if_noexcept, returns_an_rvalue_given_a_move_only_type)
+{
+    using moved_type = decltype(sut::move_if_noexcept(
+        std::declval<some_move_only_type&>()));
+
+    StaticAssertTypeEq<moved_type, some_move_only_type&&>();
+}
+
+TEST(pair, holds_the_given_values)
+{
+    auto p = sut::pair{1, 'a'};
+
+    ASSERT_THAT(p.first, Eq(1));
+    ASSERT_THAT(p.second, Eq('a'));
+}
+
+TEST(pair, is_value_initialized_when_default_constructed)
+{
+    auto p = sut::pair<int, int>();
+
+    ASSERT_THAT(p.first, Eq(0));
+    ASSERT_THAT(p.second, Eq(0));
+}
+
+TEST(pair, supports_structured_bindings)
+{
+    auto [first, second] = sut::make_pair(1, 2);
+
+    ASSERT_THAT(first, Eq(1));
+    ASSERT_THAT(second, Eq(2));
+}
+
+TEST(pair, compares_equal_to_a_pair_with_the_same_values)
+{
+    ASSERT_TRUE(sut::make_pair(1, 2) == sut::make_pair(1, 2));
+    ASSERT_TRUE(sut::make_pair(1, 2) != sut::make_pair(1, 3));
+}
+
+TEST(make_integer_sequence, holds_the_integers_up_to_the_given_count)
+{
+    StaticAssertTypeEq<sut::make_integer_sequence<int, 0>,
+                       sut::integer_sequence<int>>();
+    StaticAssertTypeEq<sut::make_integer_sequence<char, 3>,
+                       sut::integer_sequence<char, 0, 1, 2>>();
+    static_assert(sut::make_index_sequence<5>::size() == 5);
+}
+
+TEST(index_sequence_for, holds_an_index_per_type)
+{
+    StaticAssertTypeEq<sut::index_sequence_for<int, char, int>,
+                       sut::index_sequence<0, 1, 2>>();
+}
@@ -1,6 +1,11 @@
 #include "gmock/gmock.h"
 
 #include "sut/vector"
+#include "sut/memory_resource"
+
+#include "test_iterators.hpp"
+
+#include <vector>
 
 using namespace testing;
 
@@ -303,3 +308,1057 @@ TEST(a_vector, returns_a_pointer_to_an_array_containing_all_element_for_const_da
 
     ASSERT_THAT(data_vec, ElementsAreArray(some_const_vec));
 }
+
+namespace
+{
+
+struct move_counter
+{
+    static inline int copies = 0;
+    static inline int moves = 0;
+
+    move_counter() = default;
+    move_counter(const move_counter&) {++copies;}
+    move_counter(move_counter&&) noexcept {++moves;}
+};
+
+struct instance_counter
+{
+    static inline int instances = 0;
+
+    instance_counter() {++instances;}
+    instance_counter(const instance_counter&) {++instances;}
+    instance_counter(instance_counter&&) noexcept {++instances;}
+    instance_counter& operator=(const instance_counter&) = default;
+    ~instance_counter() {--instances;}
+};
+
+struct throwing_move_counter
+{
+    static inline int copies = 0;
+    static inline int moves = 0;
+
+    throwing_move_counter() = default;
+    throwing_move_counter(const throwing_move_counter&) {++copies;}
+    throwing_move_counter(throwing_move_counter&&) {++moves;}
+};
+
+// Counts its instances and throws from its copy constructor or assignment
+// once copies_left more copies have been made. Without move operations, moves
+// copy too.
+struct throwing_copy_counter
+{
+    static inline int instances = 0;
+    static inline int copies_left = -1;
+
+    explicit throwing_copy_counter(int value = 0) : value{value} {++instances;}
+
+    throwing_copy_counter(const throwing_copy_counter& other)
+        : value{other.value}
+    {
+        if (copies_left-- == 0)
+            throw other.value;
+
+        ++instances;
+    }
+
+    throwing_copy_counter& operator=(const throwing_copy_counter& other)
+    {
+        if (copies_left-- == 0)
+            throw other.value;
+
+        value = other.value;
+        return *this;
+    }
+
+    ~throwing_copy_counter() {--instances;}
+
+    int value;
+};
+
+}
+
+TEST(a_vector, contains_the_pushed_back_elements_in_order)
+{
+    auto vec = sut::vector<some_type>();
+
+    for (auto value : some_initializer_list)
+        vec.push_back(value);
+
+    ASSERT_THAT(vec, ElementsAreArray(some_initializer_list));
+}
+
+TEST(a_vector, returns_a_reference_to_the_new_element_for_emplace_back)
+{
+    auto vec = sut::vector<some_type>();
+
+    auto& element = vec.emplace_back(some_value);
+
+    ASSERT_THAT(&element, Eq(&vec.back()));
+    ASSERT_THAT(element, Eq(some_value));
+}
+
+TEST(a_vector, supports_pushing_back_one_of_its_own_elements_when_full)
+{
+    auto vec = some_vec1;
+    ASSERT_THAT(vec.size(), Eq(vec.capacity()));
+
+    vec.push_back(vec.front());
+
+    ASSERT_THAT(vec.back(), Eq(some_vec1.front()));
+}
+
+TEST(a_vector, grows_its_capacity_geometrically)
+{
+    auto vec = sut::vector<some_type>();
+    auto reallocations = 0;
+
+    for (auto i = 0; i < 1024; ++i)
+    {
+        auto capacity = vec.capacity();
+        vec.push_back(i);
+
+        if (vec.capacity() != capacity)
+            ++reallocations;
+    }
+
+    ASSERT_THAT(reallocations, Le(11));
+}
+
+TEST(a_vector, does_not_reallocate_when_pushing_back_within_reserved_capacity)
+{
+    auto vec = sut::vector<some_type>();
+    vec.reserve(some_size);
+    auto data = vec.data();
+
+    for (sut::size_t i = 0; i < some_size; ++i)
+        vec.push_back(some_value);
+
+    ASSERT_THAT(vec.data(), Eq(data));
+}
+
+TEST(a_vector, has_at_least_the_reserved_capacity)
+{
+    auto vec = sut::vector<some_type>();
+
+    vec.reserve(some_size);
+
+    ASSERT_THAT(vec.capacity(), Ge(some_size));
+}
+
+TEST(a_vector, keeps_its_elements_when_reserving)
+{
+    auto vec = some_vec1;
+
+    vec.reserve(2 * some_vec1.capacity());
+
+    ASSERT_THAT(vec, ElementsAreArray(some_vec1));
+}
+
+TEST(a_vector, does_not_shrink_when_reserving_less_than_its_capacity)
+{
+    auto vec = some_vec1;
+    auto capacity = vec.capacity();
+
+    vec.reserve(0);
+
+    ASSERT_THAT(vec.capacity(), Eq(capacity));
+}
+
+TEST(a_vector, has_capacity_equal_to_its_size_after_shrink_to_fit)
+{
+    auto vec = some_vec1;
+    vec.reserve(2 * some_vec1.capacity());
+
+    vec.shrink_to_fit();
+
+    ASSERT_THAT(vec.capacity(), Eq(vec.size()));
+    ASSERT_THAT(vec, ElementsAreArray(some_vec1));
+}
+
+TEST(a_vector, removes_the_last_element_for_pop_back)
+{
+    auto vec = some_vec1;
+
+    vec.pop_back();
+
+    ASSERT_THAT(vec, ElementsAreArray(some_vec1.begin(), some_vec1.end() - 1));
+}
+
+TEST(a_vector, is_unchanged_when_copying_an_element_throws_while_growing)
+{
+    throwing_copy_counter::instances = 0;
+
+    {
+        auto vec = sut::vector<throwing_copy_counter>();
+        vec.reserve(4);
+
+        for (auto i = 0; i < 4; ++i)
+            vec.emplace_back(i);
+
+        throwing_copy_counter::copies_left = 2;
+        ASSERT_THROW(vec.push_back(throwing_copy_counter(99)), int);
+        throwing_copy_counter::copies_left = -1;
+
+        ASSERT_THAT(vec.size(), Eq(4u));
+        ASSERT_THAT(vec.capacity(), Eq(4u));
+        ASSERT_THAT(vec.back().value, Eq(3));
+        ASSERT_THAT(throwing_copy_counter::instances, Eq(4));
+    }
+
+    ASSERT_THAT(throwing_copy_counter::instances, Eq(0));
+}
+
+TEST(a_vector, moves_elements_with_noexcept_move_constructor_when_growing)
+{
+    auto vec = sut::vector<move_counter>(some_size);
+    move_counter::copies = move_counter::moves = 0;
+
+    vec.reserve(2 * some_size);
+
+    ASSERT_THAT(move_counter::copies, Eq(0));
+    ASSERT_THAT(move_counter::moves, Eq(int(some_size)));
+}
+
+TEST(a_vector, copies_elements_with_throwing_move_constructor_when_growing)
+{
+    auto vec = sut::vector<throwing_move_counter>(some_size);
+    throwing_move_counter::copies = throwing_move_counter::moves = 0;
+
+    vec.reserve(2 * some_size);
+
+    ASSERT_THAT(throwing_move_counter::moves, Eq(0));
+    ASSERT_THAT(throwing_move_counter::copies, Eq(int(some_size)));
+}
+
+TEST(a_vector, contains_count_bytes_equal_to_the_given_value)
+{
+    auto vec = sut::vector<unsigned char>(some_size, 0xa5);
+
+    ASSERT_THAT(vec, Each(Eq(0xa5)));
+}
+
+TEST(a_vector, contains_count_zeroed_elements_of_trivial_type_when_no_value_given)
+{
+    auto vec = sut::vector<double>(some_size);
+
+    ASSERT_THAT(vec, Each(Eq(0.0)));
+}
+
+TEST(a_vector, reuses_its_storage_when_assigned_trivially_copyable_elements_that_fit)
+{
+    auto vec = some_vec2;
+    auto data = vec.data();
+
+    vec = some_vec1;
+
+    ASSERT_THAT(vec.data(), Eq(data));
+    ASSERT_THAT(vec, ElementsAreArray(some_vec1));
+}
+
+TEST(a_vector, is_unchanged_after_self_assignment)
+{
+    auto vec = some_vec1;
+    auto& same_vec = vec;
+
+    vec = same_vec;
+
+    ASSERT_THAT(vec, ElementsAreArray(some_vec1));
+}
+
+TEST(a_vector, destroys_its_elements_when_destroyed)
+{
+    instance_counter::instances = 0;
+
+    {
+        auto vec = sut::vector<instance_counter>(some_size);
+    }
+
+    ASSERT_THAT(instance_counter::instances, Eq(0));
+}
+
+TEST(a_vector, destroys_the_old_elements_when_growing)
+{
+    instance_counter::instances = 0;
+
+    {
+        auto vec = sut::vector<instance_counter>(some_size);
+        vec.reserve(2 * some_size);
+
+        ASSERT_THAT(instance_counter::instances, Eq(int(some_size)));
+    }
+
+    ASSERT_THAT(instance_counter::instances, Eq(0));
+}
+
+TEST(a_vector, destroys_the_copied_elements_when_a_copy_throws_on_construction)
+{
+    throwing_copy_counter::instances = 0;
+    auto value = throwing_copy_counter();
+    throwing_copy_counter::copies_left = 2;
+
+    ASSERT_THROW(sut::vector<throwing_copy_counter>(some_size, value), int);
+
+    throwing_copy_counter::copies_left = -1;
+    ASSERT_THAT(throwing_copy_counter::instances, Eq(1));
+}
+
+TEST(a_vector, destroys_the_elements_of_nested_vectors)
+{
+    instance_counter::instances = 0;
+
+    {
+        auto inner = sut::vector<instance_counter>(some_size);
+        auto vec = sut::vector<sut::vector<instance_counter>>(some_size, inner);
+    }
+
+    ASSERT_THAT(instance_counter::instances, Eq(0));
+}
+
+TEST(a_vector, is_empty_but_keeps_its_capacity_after_clear)
+{
+    instance_counter::instances = 0;
+    auto vec = sut::vector<instance_counter>(some_size);
+    auto capacity = vec.capacity();
+
+    vec.clear();
+
+    ASSERT_TRUE(vec.empty());
+    ASSERT_THAT(vec.capacity(), Eq(capacity));
+    ASSERT_THAT(instance_counter::instances, Eq(0));
+}
+
+TEST(a_vector, destroys_the_removed_elements_when_resized_to_a_smaller_size)
+{
+    instance_counter::instances = 0;
+    auto vec = sut::vector<instance_counter>(some_size);
+
+    vec.resize(2);
+
+    ASSERT_THAT(vec.size(), Eq(2u));
+    ASSERT_THAT(instance_counter::instances, Eq(2));
+}
+
+TEST(a_vector, appends_value_initialized_elements_when_resized_to_a_larger_size)
+{
+    auto vec = some_vec1;
+
+    vec.resize(some_vec1.size() + 2);
+
+    ASSERT_THAT(vec, ElementsAre(2, 4, 3, 8, 0, 0));
+}
+
+TEST(a_vector, appends_copies_of_the_given_value_when_resized_to_a_larger_size)
+{
+    auto vec = some_vec1;
+
+    vec.resize(some_vec1.size() + 2, some_value);
+
+    ASSERT_THAT(vec, ElementsAre(2, 4, 3, 8, some_value, some_value));
+}
+
+TEST(a_vector, supports_resizing_with_one_of_its_own_elements_when_full)
+{
+    auto vec = some_vec1;
+    ASSERT_THAT(vec.size(), Eq(vec.capacity()));
+
+    vec.resize(some_vec1.size() + 2, vec.front());
+
+    ASSERT_THAT(vec, ElementsAre(2, 4, 3, 8, 2, 2));
+}
+
+TEST(a_vector, takes_no_space_for_a_stateless_allocator)
+{
+    static_assert(sizeof(sut::vector<some_type>) ==
+                  sizeof(some_type*) + 2 * sizeof(sut::size_t));
+}
+
+namespace
+{
+
+struct arena_vector : Test
+{
+    using allocator_type = sut::arena_allocator<some_type>;
+    using vector_type = sut::vector<some_type, allocator_type>;
+
+    alignas(some_type) unsigned char buffer[256];
+    sut::monotonic_buffer_resource resource{buffer};
+    allocator_type allocator{resource};
+
+    bool is_in_buffer(const some_type* p) const
+    {
+        auto bytes = reinterpret_cast<const unsigned char*>(p);
+        return bytes >= buffer && bytes < buffer + sizeof(buffer);
+    }
+};
+
+}
+
+TEST_F(arena_vector, allocates_its_elements_from_the_arena)
+{
+    auto vec = vector_type(some_initializer_list, allocator);
+
+    ASSERT_TRUE(is_in_buffer(vec.data()));
+    ASSERT_THAT(vec, ElementsAreArray(some_initializer_list));
+}
+
+TEST_F(arena_vector, keeps_allocating_from_the_arena_when_growing)
+{
+    auto vec = vector_type(allocator);
+
+    for (auto value : some_initializer_list)
+        vec.push_back(value);
+
+    ASSERT_TRUE(is_in_buffer(vec.data()));
+    ASSERT_THAT(vec, ElementsAreArray(some_initializer_list));
+}
+
+TEST_F(arena_vector, copies_use_the_same_arena)
+{
+    auto vec = vector_type(some_initializer_list, allocator);
+
+    auto copy = vec;
+
+    ASSERT_TRUE(is_in_buffer(copy.data()));
+    ASSERT_TRUE(copy.get_allocator() == allocator);
+}
+
+TEST_F(arena_vector, can_be_reused_after_releasing_the_arena)
+{
+    {
+        auto vec = vector_type(some_initializer_list, allocator);
+    }
+
+    resource.release();
+    auto vec = vector_type(some_initializer_list, allocator);
+
+    ASSERT_THAT(reinterpret_cast<unsigned char*>(vec.data()), Eq(buffer));
+}
+
+namespace
+{
+
+using some_small_size_type = sut::uint8_t;
+using small_vector_type =
+    sut::vector<some_type, sut::allocator<some_type>, some_small_size_type>;
+
+}
+
+TEST(a_vector_with_a_small_size_type, is_smaller_than_a_default_vector)
+{
+    static_assert(sizeof(small_vector_type) < sizeof(sut::vector<some_type>));
+    StaticAssertTypeEq<small_vector_type::size_type, some_small_size_type>();
+}
+
+TEST(a_vector_with_a_small_size_type, has_the_maximum_of_its_size_type_as_max_size)
+{
+    static_assert(small_vector_type::max_size() == 255);
+}
+
+TEST(a_vector_with_a_small_size_type, can_grow_up_to_its_max_size)
+{
+    auto vec = small_vector_type();
+
+    for (auto i = 0; i < 255; ++i)
+        vec.push_back(i);
+
+    ASSERT_THAT(vec.size(), Eq(255));
+    ASSERT_THAT(vec.capacity(), Eq(255));
+    ASSERT_THAT(vec.back(), Eq(254));
+}
+
+TEST(a_vector_with_a_small_size_type_death_test, aborts_when_growing_beyond_its_max_size)
+{
+    auto vec = small_vector_type(255, some_value);
+
+    ASSERT_DEATH(vec.push_back(some_value), "");
+}
+
+TEST(a_vector_with_a_small_size_type_death_test, aborts_when_constructed_from_a_range_larger_than_its_max_size)
+{
+    auto source = sut::vector<some_type>(256, some_value);
+
+    ASSERT_DEATH(small_vector_type(source.begin(), source.end()), "");
+}
+
+namespace
+{
+
+using bit_vector = sut::vector<bool>;
+constexpr auto bits_per_word = sizeof(sut::size_t) * 8;
+
+auto some_bools = {true, false, true, true, false, false, true, false, true};
+
+}
+
+TEST(a_bool_vector, contains_the_bits_from_the_given_initializer_list)
+{
+    auto vec = bit_vector(some_bools);
+
+    ASSERT_THAT(vec.size(), Eq(some_bools.size()));
+    ASSERT_THAT(vec, ElementsAreArray(some_bools));
+}
+
+TEST(a_bool_vector, stores_one_bit_per_element)
+{
+    auto vec = bit_vector(1000, true);
+
+    ASSERT_THAT(vec.capacity(), Ge(1000u));
+    ASSERT_THAT(vec.capacity(), Lt(1000u + bits_per_word));
+}
+
+TEST(a_bool_vector, contains_count_copies_of_the_given_value)
+{
+    auto vec = bit_vector(3 * bits_per_word + 5, true);
+
+    ASSERT_THAT(vec, Each(Eq(true)));
+    ASSERT_THAT(vec.count(), Eq(3 * bits_per_word + 5));
+}
+
+TEST(a_bool_vector, supports_assigning_through_references)
+{
+    auto vec = bit_vector(some_bools);
+
+    vec[1] = true;
+    vec[2] = false;
+    vec.back() = vec.front();
+
+    ASSERT_THAT(vec, ElementsAre(true, true, false, true, false, false, true,
+                                 false, true));
+}
+
+TEST(a_bool_vector, flips_a_single_bit_through_a_reference)
+{
+    auto vec = bit_vector(some_bools);
+
+    vec[0].flip();
+
+    ASSERT_FALSE(vec[0]);
+}
+
+TEST(a_bool_vector, contains_the_pushed_back_bits_across_word_boundaries)
+{
+    auto vec = bit_vector();
+    auto expected = std::vector<bool>();
+
+    for (sut::size_t i = 0; i < 3 * bits_per_word; ++i)
+    {
+        vec.push_back(i % 3 == 0);
+        expected.push_back(i % 3 == 0);
+    }
+
+    ASSERT_THAT(vec, ElementsAreArray(expected));
+}
+
+TEST(a_bool_vector, clears_the_popped_bit)
+{
+    auto vec = bit_vector(bits_per_word + 1, true);
+
+    vec.pop_back();
+    vec.pop_back();
+    vec.resize(bits_per_word + 1);
+
+    ASSERT_THAT(vec.count(), Eq(bits_per_word - 1));
+    ASSERT_FALSE(vec[bits_per_word - 1]);
+}
+
+TEST(a_bool_vector, counts_the_set_bits)
+{
+    auto vec = bit_vector(some_bools);
+
+    ASSERT_THAT(vec.count(), Eq(5u));
+}
+
+TEST(a_bool_vector, flips_all_bits_without_setting_bits_beyond_its_size)
+{
+    auto vec = bit_vector(some_bools);
+
+    vec.flip();
+
+    ASSERT_THAT(vec, ElementsAre(false, true, false, false, true, true, false,
+                                 true, false));
+    ASSERT_THAT(vec.count(), Eq(4u));
+}
+
+TEST(a_bool_vector, returns_the_index_of_the_first_set_bit_for_find_first)
+{
+    auto vec = bit_vector(3 * bits_per_word, false);
+    vec[2 * bits_per_word + 3] = true;
+
+    ASSERT_THAT(vec.find_first(), Eq(2 * bits_per_word + 3));
+}
+
+TEST(a_bool_vector, returns_its_size_for_find_first_when_no_bit_is_set)
+{
+    auto vec = bit_vector(3 * bits_per_word, false);
+
+    ASSERT_THAT(vec.find_first(), Eq(vec.size()));
+}
+
+TEST(a_bool_vector, returns_the_index_of_the_next_set_bit_for_find_next)
+{
+    auto vec = bit_vector(some_bools);
+
+    ASSERT_THAT(vec.find_next(1), Eq(2u));
+    ASSERT_THAT(vec.find_next(4), Eq(6u));
+    ASSERT_THAT(vec.find_next(9), Eq(9u));
+}
+
+TEST(a_bool_vector, sets_all_bits_in_the_given_range_for_fill)
+{
+    auto vec = bit_vector(4 * bits_per_word, false);
+
+    vec.fill(3, 3 * bits_per_word + 2, true);
+
+    for (sut::size_t i = 0; i < vec.size(); ++i)
+        ASSERT_THAT(vec[i], Eq(i >= 3 && i < 3 * bits_per_word + 2)) << i;
+}
+
+TEST(a_bool_vector, clears_all_bits_in_the_given_range_within_a_word_for_fill)
+{
+    auto vec = bit_vector(bits_per_word, true);
+
+    vec.fill(2, 5, false);
+
+    ASSERT_THAT(vec.count(), Eq(bits_per_word - 3));
+    ASSERT_FALSE(vec[2]);
+    ASSERT_FALSE(vec[4]);
+    ASSERT_TRUE(vec[5]);
+}
+
+TEST(a_bool_vector, supports_fill_of_an_empty_range_when_empty)
+{
+    auto vec = bit_vector();
+
+    vec.fill(0, 0, true);
+
+    ASSERT_TRUE(vec.empty());
+}
+
+TEST(a_bool_vector, is_unchanged_by_fill_of_an_empty_range_at_a_word_boundary)
+{
+    auto vec = bit_vector(bits_per_word, false);
+
+    vec.fill(bits_per_word, bits_per_word, true);
+
+    ASSERT_THAT(vec.count(), Eq(0u));
+}
+
+TEST(a_bool_vector, sets_the_new_bits_to_the_given_value_when_resized)
+{
+    auto vec = bit_vector(some_bools);
+
+    vec.resize(some_bools.size() + bits_per_word, true);
+
+    ASSERT_THAT(vec.count(), Eq(5u + bits_per_word));
+}
+
+TEST(a_bool_vector, has_a_random_access_iterator)
+{
+    auto vec = bit_vector(some_bools);
+
+    ASSERT_THAT(vec.end() - vec.begin(), Eq(9));
+    ASSERT_TRUE(*(vec.begin() + 3));
+    ASSERT_FALSE(vec.cbegin()[4]);
+}
+
+TEST(a_bool_vector, has_the_same_bits_as_the_other_vector_after_swap)
+{
+    auto vec1 = bit_vector(some_bools);
+    auto vec2 = bit_vector(100, true);
+
+    sut::swap(vec1, vec2);
+
+    ASSERT_THAT(vec1.count(), Eq(100u));
+    ASSERT_THAT(vec2, ElementsAreArray(some_bools));
+}
+
+TEST(a_bool_vector_with_a_small_size_type, can_hold_up_to_its_max_size_bits)
+{
+    auto vec = sut::vector<bool, sut::allocator<bool>, sut::uint8_t>(255, true);
+
+    ASSERT_THAT(vec.count(), Eq(255));
+    ASSERT_THAT(vec.capacity(), Eq(255));
+}
+
+namespace
+{
+
+some_type some_array[] = {3, 1, 4, 1, 5, 9, 2, 6};
+
+}
+
+TEST(a_vector, contains_the_elements_from_the_given_input_iterator_range)
+{
+    auto [first, last] = make_range<input_iterator>(some_array);
+
+    auto vec = sut::vector<some_type>(first, last);
+
+    ASSERT_THAT(vec, ElementsAreArray(some_array));
+}
+
+TEST(a_vector, allocates_exactly_once_for_a_forward_iterator_range)
+{
+    auto [first, last] = make_range<forward_iterator>(some_array);
+
+    auto vec = sut::vector<some_type>(first, last);
+
+    ASSERT_THAT(vec, ElementsAreArray(some_array));
+    ASSERT_THAT(vec.capacity(), Eq(std::size(some_array)));
+}
+
+TEST(a_vector, reuses_its_storage_when_assigned_a_range_that_fits)
+{
+    auto vec = sut::vector<some_type>(std::size(some_array) + 1, some_value);
+    auto data = vec.data();
+
+    vec.assign(std::begin(some_array), std::end(some_array));
+
+    ASSERT_THAT(vec.data(), Eq(data));
+    ASSERT_THAT(vec, ElementsAreArray(some_array));
+}
+
+TEST(a_vector, reuses_its_storage_when_assigned_an_input_range_that_fits)
+{
+    auto vec = sut::vector<some_type>(std::size(some_array) + 1, some_value);
+    auto data = vec.data();
+    auto [first, last] = make_range<input_iterator>(some_array);
+
+    vec.assign(first, last);
+
+    ASSERT_THAT(vec.data(), Eq(data));
+    ASSERT_THAT(vec, ElementsAreArray(some_array));
+}
+
+TEST(a_vector, grows_when_assigned_an_input_range_larger_than_its_size)
+{
+    auto vec = sut::vector<some_type>(2, some_value);
+    auto [first, last] = make_range<input_iterator>(some_array);
+
+    vec.assign(first, last);
+
+    ASSERT_THAT(vec, ElementsAreArray(some_array));
+}
+
+TEST(a_vector, grows_when_assigned_a_forward_range_larger_than_its_capacity)
+{
+    auto vec = sut::vector<some_type>(2, some_value);
+    auto [first, last] = make_range<forward_iterator>(some_array);
+
+    vec.assign(first, last);
+
+    ASSERT_THAT(vec, ElementsAreArray(some_array));
+}
+
+TEST(a_vector, destroys_surplus_elements_when_assigned_a_smaller_range)
+{
+    instance_counter::instances = 0;
+    auto vec = sut::vector<instance_counter>(some_size);
+    instance_counter source[2];
+
+    vec.assign(std::begin(source), std::end(source));
+
+    ASSERT_THAT(vec.size(), Eq(2u));
+    ASSERT_THAT(instance_counter::instances, Eq(4));
+}
+
+TEST(a_vector, contains_count_copies_of_the_given_value_after_assign)
+{
+    auto vec = some_vec2;
+    auto data = vec.data();
+
+    vec.assign(3, some_value);
+
+    ASSERT_THAT(vec.data(), Eq(data));
+    ASSERT_THAT(vec, ElementsAre(some_value, some_value, some_value));
+}
+
+TEST(a_vector, grows_when_assigned_more_copies_than_its_capacity)
+{
+    auto vec = some_vec1;
+
+    vec.assign(some_vec1.capacity() + 1, some_value);
+
+    ASSERT_THAT(vec.size(), Eq(some_vec1.capacity() + 1));
+    ASSERT_THAT(vec, Each(Eq(some_value)));
+}
+
+TEST(a_vector, contains_the_elements_of_the_initializer_list_after_assign)
+{
+    auto vec = some_vec2;
+
+    vec.assign(some_initializer_list);
+
+    ASSERT_THAT(vec, ElementsAreArray(some_initializer_list));
+}
+
+TEST(a_vector, contains_the_inserted_element_at_the_given_position)
+{
+    auto vec = sut::vector{1, 2, 3};
+
+    auto it = vec.insert(vec.begin() + 1, some_value);
+
+    ASSERT_THAT(it, Eq(vec.begin() + 1));
+    ASSERT_THAT(vec, ElementsAre(1, some_value, 2, 3));
+}
+
+TEST(a_vector, inserts_an_element_referring_to_itself_when_growing)
+{
+    auto vec = sut::vector{1, 2, 3};
+    vec.shrink_to_fit();
+
+    vec.insert(vec.begin(), vec.back());
+
+    ASSERT_THAT(vec, ElementsAre(3, 1, 2, 3));
+}
+
+TEST(a_vector, contains_count_copies_of_the_inserted_value)
+{
+    auto vec = sut::vector{1, 2, 3};
+
+    vec.insert(vec.begin() + 2, 2, vec.front());
+
+    ASSERT_THAT(vec, ElementsAre(1, 2, 1, 1, 3));
+}
+
+TEST(a_vector, contains_the_inserted_forward_range_at_the_given_position)
+{
+    auto vec = sut::vector{1, 2};
+    auto [first, last] = make_range<forward_iterator>(some_array);
+
+    auto it = vec.insert(vec.begin() + 1, first, last);
+
+    ASSERT_THAT(it, Eq(vec.begin() + 1));
+    ASSERT_THAT(vec, ElementsAre(1, 3, 1, 4, 1, 5, 9, 2, 6, 2));
+}
+
+TEST(a_vector, contains_the_inserted_input_range_at_the_given_position)
+{
+    auto vec = sut::vector{1, 2};
+    auto [first, last] = make_range<input_iterator>(some_array);
+
+    auto it = vec.insert(vec.begin() + 1, first, last);
+
+    ASSERT_THAT(it, Eq(vec.begin() + 1));
+    ASSERT_THAT(vec, ElementsAre(1, 3, 1, 4, 1, 5, 9, 2, 6, 2));
+}
+
+TEST(a_vector, contains_the_inserted_initializer_list_at_the_given_position)
+{
+    auto vec = sut::vector{1, 2};
+
+    vec.insert(vec.end(), {7, 8});
+
+    ASSERT_THAT(vec, ElementsAre(1, 2, 7, 8));
+}
+
+TEST(a_vector, constructs_the_emplaced_element_at_the_given_position)
+{
+    struct pair {int a, b;};
+    auto vec = sut::vector<pair>{{1, 2}, {3, 4}};
+
+    vec.emplace(vec.begin(), pair{5, 6});
+
+    ASSERT_THAT(vec.front().a, Eq(5));
+    ASSERT_THAT(vec[1].a, Eq(1));
+    ASSERT_THAT(vec[2].b, Eq(4));
+}
+
+TEST(a_vector, no_longer_contains_the_erased_element)
+{
+    auto vec = sut::vector{1, 2, 3, 4};
+
+    auto it = vec.erase(vec.begin() + 1);
+
+    ASSERT_THAT(*it, Eq(3));
+    ASSERT_THAT(vec, ElementsAre(1, 3, 4));
+}
+
+TEST(a_vector, no_longer_contains_the_erased_range)
+{
+    auto vec = sut::vector{1, 2, 3, 4, 5};
+
+    auto it = vec.erase(vec.begin() + 1, vec.begin() + 3);
+
+    ASSERT_THAT(it, Eq(vec.begin() + 1));
+    ASSERT_THAT(vec, ElementsAre(1, 4, 5));
+}
+
+TEST(a_vector, destroys_the_erased_elements)
+{
+    instance_counter::instances = 0;
+    auto vec = sut::vector<instance_counter>(some_size);
+
+    vec.erase(vec.begin(), vec.begin() + 2);
+
+    ASSERT_THAT(vec.size(), Eq(some_size - 2));
+    ASSERT_THAT(instance_counter::instances, Eq(int(some_size - 2)));
+}
+
+TEST(a_vector, keeps_the_instance_count_when_inserting_non_trivial_elements)
+{
+    instance_counter::instances = 0;
+    {
+        auto vec = sut::vector<instance_counter>(some_size);
+
+        vec.insert(vec.begin() + 1, 3, instance_counter());
+        vec.insert(vec.begin() + 2, instance_counter());
+
+        ASSERT_THAT(instance_counter::instances, Eq(int(some_size + 4)));
+    }
+    ASSERT_THAT(instance_counter::instances, Eq(0));
+}
+
+TEST(a_vector, is_unchanged_when_copying_an_element_throws_while_inserting)
+{
+    throwing_copy_counter::instances = 0;
+
+    {
+        auto vec = sut::vector<throwing_copy_counter>();
+        vec.reserve(4);
+
+        for (auto i = 0; i < 4; ++i)
+            vec.emplace_back(i);
+
+        throwing_copy_counter::copies_left = 2;
+        ASSERT_THROW(vec.insert(vec.begin(), throwing_copy_counter(99)), int);
+        throwing_copy_counter::copies_left = -1;
+
+        ASSERT_THAT(vec.size(), Eq(4u));
+        ASSERT_THAT(vec.front().value, Eq(0));
+        ASSERT_THAT(vec.back().value, Eq(3));
+        ASSERT_THAT(throwing_copy_counter::instances, Eq(4));
+    }
+
+    ASSERT_THAT(throwing_copy_counter::instances, Eq(0));
+}
+
+// Applies modify to a vector with spare capacity while making each copy in
+// turn throw and checks that no element is leaked or destroyed twice.
+template<typename Modify>
+void expect_no_lost_elements_when_copying_throws(Modify modify)
+{
+    auto outside_instances = throwing_copy_counter::instances;
+
+    for (auto throw_at = 0; throw_at < 16; ++throw_at)
+    {
+        {
+            auto vec = sut::vector<throwing_copy_counter>();
+            vec.reserve(8);
+
+            for (auto i = 0; i < 4; ++i)
+                vec.emplace_back(i);
+
+            throwing_copy_counter::copies_left = throw_at;
+
+            try
+            {
+                modify(vec);
+            }
+            catch (int)
+            {
+            }
+
+            throwing_copy_counter::copies_left = -1;
+
+            ASSERT_THAT(throwing_copy_counter::instances,
+                        Eq(outside_instances + int(vec.size())));
+        }
+
+        ASSERT_THAT(throwing_copy_counter::instances, Eq(outside_instances));
+    }
+}
+
+TEST(a_vector, keeps_its_elements_when_copying_throws_while_inserting_copies)
+{
+    expect_no_lost_elements_when_copying_throws([](auto& vec) {
+        vec.insert(vec.begin() + 1, 3, throwing_copy_counter(99));
+    });
+}
+
+TEST(a_vector, keeps_its_elements_when_copying_throws_while_inserting_a_range)
+{
+    const auto source = sut::vector<throwing_copy_counter>(3);
+
+    expect_no_lost_elements_when_copying_throws([&](auto& vec) {
+        vec.insert(vec.begin() + 1, source.begin(), source.end());
+    });
+}
+
+TEST(a_vector, keeps_its_elements_when_copying_throws_while_emplacing)
+{
+    expect_no_lost_elements_when_copying_throws([](auto& vec) {
+        vec.emplace(vec.begin() + 1, 99);
+    });
+}
+
+TEST(a_vector, keeps_its_elements_when_moving_throws_while_erasing)
+{
+    expect_no_lost_elements_when_copying_throws([](auto& vec) {
+        vec.erase(vec.begin());
+    });
+}
+
+TEST(a_vector, relocates_nested_vectors_when_inserting)
+{
+    auto vec = sut::vector<sut::vector<int>>();
+    vec.push_back(some_vec1);
+    vec.push_back(some_vec2);
+
+    vec.insert(vec.begin() + 1, some_vec2);
+    vec.erase(vec.begin());
+
+    ASSERT_THAT(vec.size(), Eq(2u));
+    ASSERT_THAT(vec[0], ElementsAreArray(some_vec2));
+    ASSERT_THAT(vec[1], ElementsAreArray(some_vec2));
+}
+
+TEST(a_vector, is_trivially_relocatable_with_the_default_allocator)
+{
+    static_assert(sut::is_trivially_relocatable_v<sut::vector<some_type>>);
+}
+
+TEST(a_vector, is_traversed_backwards_by_its_reverse_iterators)
+{
+    auto vec = sut::vector{1, 2, 3};
+    const auto& const_vec = vec;
+
+    ASSERT_THAT(sut::vector<int>(vec.rbegin(), vec.rend()),
+                ElementsAre(3, 2, 1));
+    ASSERT_THAT(sut::vector<int>(const_vec.crbegin(), const_vec.crend()),
+                ElementsAre(3, 2, 1));
+
+    *vec.rbegin() = 4;
+    ASSERT_THAT(vec.back(), Eq(4));
+}
+
+TEST(a_vector, moves_the_elements_of_a_move_iterator_range)
+{
+    move_counter sources[3];
+    move_counter::copies = move_counter::moves = 0;
+
+    auto vec = sut::vector<move_counter>(sut::make_move_iterator(sources),
+                                         sut::make_move_iterator(sources + 3));
+
+    ASSERT_THAT(vec.size(), Eq(3u));
+    ASSERT_THAT(move_counter::copies, Eq(0));
+    ASSERT_THAT(move_counter::moves, Eq(3));
+}
+
+TEST(a_vector, is_filled_through_a_back_insert_iterator)
+{
+    int values[] = {1, 2, 3};
+    auto vec = sut::vector<int>{0};
+
+    sut::copy(values, values + 3, sut::back_inserter(vec));
+
+    ASSERT_THAT(vec, ElementsAre(0, 1, 2, 3));
+}
+
+TEST(a_bool_vector, is_traversed_backwards_by_its_reverse_iterators)
+{
+    auto vec = sut::vector<bool>{true, false, false};
+
+    ASSERT_THAT(sut::vector<bool>(vec.rbegin(), vec.rend()),
+                ElementsAre(false, false, true));
+}